@@ -0,0 +1,272 @@
+/**
+ * @file      async_object_invoke.h
+ *
+ * @brief     Contains the C++20 coroutines object invoke flavor: the acceptor
+ *            returns the awaitable, and the invoke suspends, while the sink
+ *            applies the backpressure
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__ASYNC_OBJECT_INVOKE__H
+#define INCLUDE__ASYNC_OBJECT_INVOKE__H
+
+/* the flavor is available only when the coroutines are enabled (C++20) */
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+/* library parts */
+#include <object_invoke.h>
+#include <inline_object_invoke.h>
+#include <metaprogramming_base.h>
+
+/* STL */
+#include <cstddef>
+#include <array>
+#include <utility>
+#include <exception>
+#include <coroutine>
+#include <type_traits>
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      The lazy coroutine without result. Started by start() or by
+     *             co_await from the other coroutine, which is resumed, when
+     *             the task is finished
+     */
+    class task {
+    public:
+        struct promise_type;
+
+        using handle_t = std::coroutine_handle<promise_type>;
+
+        /**
+         * @brief      The promise of the task, keeps the awaiting coroutine
+         */
+        struct promise_type {
+            std::coroutine_handle<> continuation { std::noop_coroutine() };
+
+            task get_return_object() noexcept {
+                return task{ handle_t::from_promise(*this) };
+            }
+
+            std::suspend_always initial_suspend() noexcept {
+                return {};
+            }
+
+            /**
+             * @brief      Transfers the control into the awaiting coroutine
+             */
+            auto final_suspend() noexcept {
+                struct final_awaiter {
+                    bool await_ready() noexcept {
+                        return false;
+                    }
+
+                    std::coroutine_handle<> await_suspend(handle_t aHandle) noexcept {
+                        return aHandle.promise().continuation;
+                    }
+
+                    void await_resume() noexcept {}
+                };
+                return final_awaiter{ };
+            }
+
+            void return_void() noexcept {}
+
+            void unhandled_exception() noexcept {
+                std::terminate();
+            }
+        };
+
+        task(task && aOther) noexcept
+            : m_handle { std::exchange(aOther.m_handle, nullptr) }
+        {}
+
+        task & operator=(task && aOther) noexcept {
+            if (this != &aOther) {
+                this->destroy();
+                m_handle = std::exchange(aOther.m_handle, nullptr);
+            }
+            return *this;
+        }
+
+        task(task const &) = delete;
+        task & operator=(task const &) = delete;
+
+        ~task() {
+            this->destroy();
+        }
+
+        /**
+         * @brief      Runs the task until the first suspension point
+         */
+        void start() {
+            m_handle.resume();
+        }
+
+        /**
+         * @brief      Returns true, if the task is finished
+         */
+        bool done() const noexcept {
+            return !m_handle || m_handle.done();
+        }
+
+        /**
+         * @brief      Starts the task from the awaiting coroutine, the
+         *             awaiting coroutine is resumed, when the task is finished
+         */
+        auto operator co_await() && noexcept {
+            struct awaiter {
+                handle_t handle;
+
+                bool await_ready() noexcept {
+                    return !handle || handle.done();
+                }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<> aAwaiting) noexcept {
+                    handle.promise().continuation = aAwaiting;
+                    return handle;
+                }
+
+                void await_resume() noexcept {}
+            };
+            return awaiter{ m_handle };
+        }
+    private:
+        explicit task(handle_t aHandle) noexcept
+            : m_handle { aHandle }
+        {}
+
+        void destroy() noexcept {
+            if (m_handle) {
+                m_handle.destroy();
+            }
+        }
+
+        handle_t m_handle;
+    };
+
+    /**
+     * @brief      Initial definition, unused
+     */
+    template<typename TInvoke>
+    struct async_object_invoke;
+
+    /**
+     * @brief      The object invoke for the asynchronous sinks: the acceptor
+     *             returns the awaitable, which is co_awaited after every
+     *             result. The awaitable shall be ready, while the sink is able
+     *             to take more data, so the invoke suspends only under the
+     *             backpressure, and is resumed by the sink later. One thread
+     *             is able to interleave many object snapshots with their
+     *             output this way
+     *
+     * @note       The acceptor shall consume the result before it returns,
+     *             the result may refer to the intermediate objects, which
+     *             are destroyed at the suspension. The awaitable type shall
+     *             be the same for all the results
+     *
+     * @note       The object and the acceptor shall outlive the task. Every
+     *             call allocates the coroutine frame
+     *
+     * @tparam     TResultAcceptor    Callable object, which invoked with the
+     *                                tag and the result of the function, and
+     *                                returns the awaitable
+     * @tparam     TForwarders        Types of the delayed invoke forwarders
+     */
+    template<typename TResultAcceptor, typename ... TForwarders>
+    struct async_object_invoke<inline_object_invoke<TResultAcceptor, TForwarders...>> {
+    public:
+        using object_t    = detail::invokers_class_t<TForwarders...>;
+        using acceptor_t  = TResultAcceptor;
+        using invokers_t  = flat_tuple<TForwarders...>;
+        using awaitable_t = decltype(std::declval<first_t<TForwarders...> const &>()(std::declval<object_t &>(),
+                                                                                       std::declval<acceptor_t &>()));
+
+        static_assert((std::is_same_v<awaitable_t, decltype(std::declval<TForwarders const &>()(std::declval<object_t &>(),
+                                                                                                  std::declval<acceptor_t &>()))> && ...),
+                      "The acceptor shall return the same awaitable type for all the results");
+
+        static constexpr size_t INVOKERS_COUNT { sizeof...(TForwarders) };
+
+        /**
+         * @brief      Creates the async object invoke
+         *
+         * @param      aInvoke    The inline object invoke to take the
+         *                        invokers from
+         */
+        explicit constexpr async_object_invoke(inline_object_invoke<TResultAcceptor, TForwarders...> const & aInvoke)
+            : m_invokers { aInvoke.invokers() }
+        {}
+
+        /**
+         * @brief      Invokes all the registered invokers in the registration
+         *             order, passes every result into the acceptor and awaits
+         *             the returned awaitable
+         *
+         * @return     The task, not started yet
+         */
+        task operator()(object_t & aObj, acceptor_t & aAcceptor) const {
+            for (auto const invoker: INVOKERS) {
+                co_await (*invoker)(m_invokers, aObj, aAcceptor);
+            }
+        }
+    private:
+        using invoker_ptr_t = awaitable_t(*)(invokers_t const &, object_t &, acceptor_t &);
+
+        /**
+         * @brief      Invokes the single invoker and returns the awaitable
+         *
+         * @tparam     Idx    Index of the invoker
+         */
+        template<size_t Idx>
+        static awaitable_t invokeOne(invokers_t const & aInvokers, object_t & aObj, acceptor_t & aAcceptor) {
+            return get<Idx>(aInvokers)(aObj, aAcceptor);
+        }
+
+        /**
+         * @brief      Makes the table of the invokers
+         *
+         * @tparam     Idx    Indexes of the invokers
+         */
+        template<size_t ... Idx>
+        static constexpr std::array<invoker_ptr_t, INVOKERS_COUNT> makeInvokers(std::index_sequence<Idx...>) noexcept {
+            return { &invokeOne<Idx>... };
+        }
+
+        static constexpr std::array<invoker_ptr_t, INVOKERS_COUNT> INVOKERS {
+            makeInvokers(std::index_sequence_for<TForwarders...>{})
+        };
+
+        invokers_t m_invokers;
+    };
+
+    /* class deduction guides */
+    template<typename TInvoke>
+    explicit async_object_invoke(TInvoke) -> async_object_invoke<TInvoke>;
+
+} /* end of namespace mil */
+
+#endif /* end of #if defined(__cpp_impl_coroutine) && __has_include(<coroutine>) */
+
+#endif /* end of #ifndef INCLUDE__ASYNC_OBJECT_INVOKE__H */
@@ -0,0 +1,278 @@
+/**
+ * @file      batch_object_invoke.h
+ *
+ * @brief     Contains the object invoke flavor, which processes the whole
+ *            range of the objects at once and passes the results into the
+ *            acceptor column by column
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__BATCH_OBJECT_INVOKE__H
+#define INCLUDE__BATCH_OBJECT_INVOKE__H
+
+/* library parts */
+#include <chain_invoke.h>
+#include <object_invoke.h>
+#include <metaprogramming_base.h>
+
+/* STL */
+#include <cstddef>
+#include <tuple>
+#include <memory>
+#include <utility>
+#include <iterator>
+#include <type_traits>
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      The read-only view of the columns, passed into the column
+     *             acceptor. Column number Idx holds Idx-th element of every
+     *             result tuple, one value per object
+     *
+     * @tparam     T    Types of the result tuple elements
+     */
+    template<typename ... T>
+    struct columns {
+        /**
+         * @brief      Number of values in every column
+         */
+        size_t                  size;
+
+        /**
+         * @brief      Pointers to the first values of the columns
+         */
+        std::tuple<T const *...> data;
+
+        /**
+         * @brief      Returns the column
+         *
+         * @tparam     Idx    Index of the column
+         */
+        template<size_t Idx>
+        constexpr auto column() const noexcept {
+            return std::get<Idx>(data);
+        }
+    };
+
+    /**
+     * @brief      The storage of the single column, grows on demand and never
+     *             shrinks, so there are no allocations in the steady state
+     *
+     * @tparam     T    Type of the values
+     */
+    template<typename T>
+    struct column_storage {
+        /**
+         * @brief      Makes sure the storage fits the requested number of
+         *             values
+         *
+         * @param      aSize    Number of values
+         *
+         * @return     Pointer to the first value
+         */
+        T * prepare(size_t aSize) {
+            if (aSize > m_capacity) {
+                m_data.reset(new T[aSize]);
+                m_capacity = aSize;
+            }
+            return m_data.get();
+        }
+    private:
+        std::unique_ptr<T[]> m_data     { };
+        size_t               m_capacity { 0 };
+    };
+
+    /**
+     * @brief      detail component namespace
+     */
+    namespace detail {
+    /** @{ */
+    /* column_buffers meta-function, makes column storages for the result tuple */
+        /**
+         * @brief      Initial definition
+         */
+        template<typename Tuple>
+        struct column_buffers;
+
+        /**
+         * @brief      Overload for the result tuple
+         *
+         * @tparam     T    Types of the result tuple elements
+         */
+        template<typename ... T>
+        struct column_buffers<std::tuple<T...>> {
+            using type = std::tuple<column_storage<T>...>;
+            using view = columns<T...>;
+        };
+    /** @} */
+
+        /**
+         * @brief      Returns type of the methods chain result
+         *
+         * @tparam     fx     Methods of the chain
+         * @tparam     TObj   Type of the object
+         */
+        template<auto ... fx, typename TObj>
+        auto chainResult(values_list<fx...>, TObj & aObj) -> decltype(chainInvoke<fx...>(aObj));
+
+        /**
+         * @brief      Per-forwarder batch types
+         *
+         * @tparam     TForwarder    Type of the delayed invoke forwarder
+         */
+        template<typename TForwarder>
+        struct batch_traits {
+            using object_t  = typename TForwarder::cl;
+            using result_t  = decltype(chainResult(typename TForwarder::chain_t{}, std::declval<object_t &>()));
+            using storage_t = typename column_buffers<result_t>::type;
+            using view_t    = typename column_buffers<result_t>::view;
+        };
+    } /* end of namespace detail */
+
+    /**
+     * @brief      The object invoke, which invokes every registered chain for
+     *             the whole range of the objects, stores the results into the
+     *             columns (one column per result tuple element), and passes
+     *             all the columns of the tag into the acceptor in one call
+     *
+     * @note       The acceptor is invoked as
+     *             `aAcceptor(tag, mil::columns<T...> const &)`, the columns
+     *             are valid only during the call
+     *
+     * @tparam     TColumnAcceptor    Callable object, which invoked with the
+     *                                tag and the columns of the results
+     * @tparam     TForwarders        Types of the delayed invoke forwarders
+     */
+    template<typename TColumnAcceptor, typename ... TForwarders>
+    struct batch_object_invoke {
+    public:
+        using object_t   = detail::invokers_class_t<TForwarders...>;
+        using acceptor_t = TColumnAcceptor;
+
+        /**
+         * @brief      Storage of all the columns, shall be kept by the caller
+         *             between the calls to avoid allocations
+         */
+        using buffers_t  = std::tuple<typename detail::batch_traits<TForwarders>::storage_t...>;
+
+        static constexpr size_t INVOKERS_COUNT { sizeof...(TForwarders) };
+
+        /**
+         * @brief      Creates the batch object invoke object
+         *
+         * @param      aInvokers    The delayed invoke forwarders
+         */
+        explicit constexpr batch_object_invoke(acceptor<acceptor_t>, TForwarders const & ... aInvokers)
+            : m_invokers { aInvokers... }
+        {}
+
+        /**
+         * @brief      Invokes all the registered invokers for every object of
+         *             the range and passes the columns into the acceptor
+         *
+         * @param      aObjects     Pointer to the first object
+         * @param      aCount       Number of the objects
+         * @param      aBuffers     Columns storage
+         * @param      aAcceptor    The column acceptor
+         */
+        void operator()(object_t * aObjects, size_t aCount, buffers_t & aBuffers, acceptor_t & aAcceptor) const {
+            this->invokeImpl(std::index_sequence_for<TForwarders...>{}, aObjects, aCount, aBuffers, aAcceptor);
+        }
+
+        /**
+         * @brief      Same as above, but for any contiguous range
+         *
+         * @tparam     TRange    Type of the range (array, vector, etc)
+         */
+        template<typename TRange>
+        void operator()(TRange & aRange, buffers_t & aBuffers, acceptor_t & aAcceptor) const {
+            (*this)(std::data(aRange), std::size(aRange), aBuffers, aAcceptor);
+        }
+    private:
+        /**
+         * @brief      The implementation of the invoke, processes the
+         *             invokers one by one in the registration order
+         *
+         * @tparam     Idx    Indexes of the invokers
+         */
+        template<size_t ... Idx>
+        void invokeImpl(std::index_sequence<Idx...>, object_t * aObjects, size_t aCount,
+                        buffers_t & aBuffers, acceptor_t & aAcceptor) const {
+            (fillAndAccept<Idx>(typename TForwarders::chain_t{}, aObjects, aCount, std::get<Idx>(aBuffers), aAcceptor), ...);
+        }
+
+        /**
+         * @brief      Fills the columns of the single invoker and passes them
+         *             into the acceptor
+         *
+         * @tparam     Idx        Index of the invoker
+         * @tparam     fx         Methods chain of the invoker
+         * @tparam     TStorage   Type of the columns storage
+         */
+        template<size_t Idx, auto ... fx, typename TStorage>
+        void fillAndAccept(values_list<fx...>, object_t * aObjects, size_t aCount,
+                           TStorage & aStorage, acceptor_t & aAcceptor) const {
+            using traits_t = detail::batch_traits<flat_tuple_element_t<Idx, flat_tuple<TForwarders...>>>;
+            constexpr size_t COLUMNS { std::tuple_size_v<typename traits_t::result_t> };
+
+            auto const data { prepare(aStorage, aCount, std::make_index_sequence<COLUMNS>{}) };
+            for (size_t i { 0 }; i < aCount; ++i) {
+                chainInvokeWith<fx...>(aObjects[i], [&](auto && aResult) {
+                    scatter(std::move(aResult), data, i, std::make_index_sequence<COLUMNS>{});
+                });
+            }
+
+            typename traits_t::view_t const view { aCount, data };
+            aAcceptor(get<Idx>(m_invokers).tag(), view);
+        }
+
+        /**
+         * @brief      Prepares every column of the storage
+         *
+         * @return     Tuple of pointers to the columns
+         */
+        template<typename TStorage, size_t ... Col>
+        static auto prepare(TStorage & aStorage, size_t aCount, std::index_sequence<Col...>) {
+            return std::make_tuple(std::get<Col>(aStorage).prepare(aCount)...);
+        }
+
+        /**
+         * @brief      Moves every element of the result tuple into the
+         *             corresponding column
+         */
+        template<typename TResult, typename TData, size_t ... Col>
+        static void scatter(TResult && aResult, TData const & aData, size_t aPos, std::index_sequence<Col...>) {
+            ((std::get<Col>(aData)[aPos] = std::move(std::get<Col>(aResult))), ...);
+        }
+
+        flat_tuple<TForwarders...>   m_invokers;
+    };
+
+    /* class deduction guides */
+    template<typename TColumnAcceptor, typename ... T>
+    explicit batch_object_invoke(acceptor<TColumnAcceptor>, T ...) -> batch_object_invoke<TColumnAcceptor, T...>;
+
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__BATCH_OBJECT_INVOKE__H */
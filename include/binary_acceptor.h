@@ -0,0 +1,155 @@
+/**
+ * @file      binary_acceptor.h
+ *
+ * @brief     Contains the acceptor, which writes the results into the caller
+ *            supplied buffer using the compact little-endian binary layout
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__BINARY_ACCEPTOR__H
+#define INCLUDE__BINARY_ACCEPTOR__H
+
+/* library parts */
+#include <tag_string.h>
+#include <binary_layout.h>
+
+/* STL */
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      The acceptor, which writes every result into the caller
+     *             supplied buffer. Every record is
+     *             `[u64 tag id][tuple elements]`, all the integers and
+     *             floating point values are little-endian. The tag id is the
+     *             `mil::tagId` of the tag name, for the compile-time tags
+     *             it's known in compile time
+     *
+     * @note       The size of the record is computed in compile time, so there
+     *             is the only bounds check per tag. When the record doesn't
+     *             fit, nothing is written and the acceptor is marked as
+     *             overflowed, all the next records are dropped as well, so
+     *             the buffer always contains whole records. The acceptor
+     *             never allocates
+     */
+    class binary_acceptor {
+    public:
+        /**
+         * @brief      Creates the binary acceptor
+         *
+         * @param      aBuffer      The output buffer
+         * @param      aCapacity    Size of the output buffer
+         */
+        binary_acceptor(void * aBuffer, size_t aCapacity) noexcept
+            : m_begin { static_cast<unsigned char *>(aBuffer) }
+            , m_pos   { m_begin                               }
+            , m_end   { m_begin + aCapacity                   }
+        {}
+
+        /**
+         * @brief      Writes the record
+         *
+         * @param      aTag      Associated tag
+         * @param      aTuple    The result of the methods chain
+         */
+        template<typename ... T>
+        void operator()(char const * aTag, std::tuple<T...> const & aTuple) noexcept {
+            this->write(tagId(aTag), aTuple);
+        }
+
+        /**
+         * @brief      Writes the record with the compile-time tag
+         *
+         * @param      <pos>     The compile-time tag
+         * @param      aTuple    The result of the methods chain
+         */
+        template<char ... cs, typename ... T>
+        void operator()(tag_string<cs...>, std::tuple<T...> const & aTuple) noexcept {
+            this->write(tag_string<cs...>::id, aTuple);
+        }
+
+        /**
+         * @brief      Returns the beginning of the written data
+         */
+        unsigned char const * data() const noexcept {
+            return m_begin;
+        }
+
+        /**
+         * @brief      Returns number of the written bytes
+         */
+        size_t size() const noexcept {
+            return static_cast<size_t>(m_pos - m_begin);
+        }
+
+        /**
+         * @brief      Returns true, if any record didn't fit the buffer
+         */
+        bool overflow() const noexcept {
+            return m_overflow;
+        }
+
+        /**
+         * @brief      Starts writing from the beginning of the buffer
+         */
+        void reset() noexcept {
+            m_pos      = m_begin;
+            m_overflow = false;
+        }
+    private:
+        /**
+         * @brief      Writes the whole record
+         *
+         * @param      aTagId    Id of the tag
+         * @param      aTuple    The result of the methods chain
+         */
+        template<typename ... T>
+        void write(uint64_t aTagId, std::tuple<T...> const & aTuple) noexcept {
+            static_assert((detail::binary_traits<std::decay_t<T>>::SUPPORTED && ...),
+                          "binary_acceptor supports only arithmetic and enum values");
+
+            constexpr size_t RECORD { sizeof(uint64_t) + binary_size_v<std::tuple<T...>> };
+
+            if (m_overflow || RECORD > size_t(m_end - m_pos)) {
+                m_overflow = true;
+                return;
+            }
+
+            detail::writeLittleEndian(m_pos, aTagId);
+            detail::writeTuple(m_pos + sizeof(uint64_t), aTuple, std::index_sequence_for<T...>{});
+            m_pos += RECORD;
+        }
+
+        unsigned char *  m_begin;
+        unsigned char *  m_pos;
+        unsigned char *  m_end;
+        bool             m_overflow { false };
+    };
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__BINARY_ACCEPTOR__H */
@@ -0,0 +1,195 @@
+/**
+ * @file      binary_layout.h
+ *
+ * @brief     Contains the compact little-endian binary layout of the values,
+ *            shared by the binary encoders and decoders
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__BINARY_LAYOUT__H
+#define INCLUDE__BINARY_LAYOUT__H
+
+/* STL */
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      detail component namespace
+     */
+    namespace detail {
+    /** @{ */
+    /* binary_traits meta-function, describes the binary layout of the type */
+        /**
+         * @brief      Initial definition, only arithmetic types and enums have
+         *             the binary layout
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T, typename = void>
+        struct binary_traits {
+            static constexpr bool SUPPORTED { false };
+        };
+
+        /**
+         * @brief      Overload for the integers, floating point and enums. The
+         *             value is stored as unsigned integer of the same size,
+         *             bool is stored as the single byte
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T>
+        struct binary_traits<T, std::enable_if_t<std::is_arithmetic_v<T> || std::is_enum_v<T>>> {
+            static constexpr bool   SUPPORTED { true      };
+            static constexpr size_t SIZE      { sizeof(T) };
+
+            using unsigned_t = std::conditional_t<SIZE == 1, uint8_t,
+                               std::conditional_t<SIZE == 2, uint16_t,
+                               std::conditional_t<SIZE == 4, uint32_t, uint64_t>>>;
+
+            static_assert(sizeof(unsigned_t) == SIZE, "Unsupported size of the arithmetic type");
+        };
+    /** @} */
+
+        /**
+         * @brief      Writes the value using the little-endian layout
+         *
+         * @tparam     T       Type of the value
+         *
+         * @param      aOut    Output position
+         * @param      aValue  The value
+         */
+        template<typename T>
+        inline void writeLittleEndian(unsigned char * aOut, T const & aValue) noexcept {
+            using unsigned_t = typename binary_traits<T>::unsigned_t;
+
+            unsigned_t bits { };
+            if constexpr (std::is_same_v<T, bool>) {
+                bits = aValue ? 1u : 0u;
+            } else {
+                std::memcpy(&bits, &aValue, sizeof(bits));
+            }
+
+            for (size_t i { 0 }; i < sizeof(bits); ++i) {
+                aOut[i] = static_cast<unsigned char>(bits >> (8u * i));
+            }
+        }
+
+        /**
+         * @brief      Reads the value stored using the little-endian layout
+         *
+         * @tparam     T      Type of the value
+         *
+         * @param      aIn    Input position
+         *
+         * @return     The value
+         */
+        template<typename T>
+        inline T readLittleEndian(unsigned char const * aIn) noexcept {
+            using unsigned_t = typename binary_traits<T>::unsigned_t;
+
+            unsigned_t bits { 0 };
+            for (size_t i { 0 }; i < sizeof(bits); ++i) {
+                bits |= static_cast<unsigned_t>(static_cast<unsigned_t>(aIn[i]) << (8u * i));
+            }
+
+            if constexpr (std::is_same_v<T, bool>) {
+                return 0 != bits;
+            } else {
+                T value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return value;
+            }
+        }
+    } /* end of namespace detail */
+
+    /**
+     * @brief      Encoded size of the tuple, known in compile time
+     *
+     * @tparam     Tuple    Type of the tuple
+     */
+    template<typename Tuple>
+    constexpr size_t binary_size_v = 0;
+
+    /**
+     * @brief      Overload for the tuple
+     *
+     * @tparam     T    Types of the tuple elements
+     */
+    template<typename ... T>
+    constexpr size_t binary_size_v<std::tuple<T...>> = (size_t{ 0 } + ... + detail::binary_traits<std::decay_t<T>>::SIZE);
+
+    /**
+     * @brief      detail component namespace
+     */
+    namespace detail {
+        /**
+         * @brief      Offsets of the tuple elements in the encoded tuple, the
+         *             last offset is the size of the whole encoded tuple
+         *
+         * @tparam     Tuple    Type of the tuple
+         */
+        template<typename Tuple>
+        struct binary_offsets;
+
+        /**
+         * @brief      Overload for the tuple
+         *
+         * @tparam     T    Types of the tuple elements
+         */
+        template<typename ... T>
+        struct binary_offsets<std::tuple<T...>> {
+            static constexpr std::array<size_t, sizeof...(T) + 1> value() noexcept {
+                std::array<size_t, sizeof...(T) + 1> offsets { };
+                size_t const sizes[] { binary_traits<std::decay_t<T>>::SIZE..., 0 };
+                for (size_t i { 0 }; i < sizeof...(T); ++i) {
+                    offsets[i + 1] = offsets[i] + sizes[i];
+                }
+                return offsets;
+            }
+        };
+
+        /**
+         * @brief      Writes all the tuple elements one by one, the output
+         *             shall have at least binary_size_v<Tuple> bytes
+         *
+         * @param      aOut      Output position
+         * @param      aTuple    The tuple
+         */
+        template<typename Tuple, size_t ... Idx>
+        inline void writeTuple(unsigned char * aOut, Tuple const & aTuple, std::index_sequence<Idx...>) noexcept {
+            size_t offset { 0 };
+            ((writeLittleEndian(aOut + offset, std::get<Idx>(aTuple)),
+              offset += binary_traits<std::decay_t<std::tuple_element_t<Idx, Tuple>>>::SIZE), ...);
+            (void)offset;
+        }
+    } /* end of namespace detail */
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__BINARY_LAYOUT__H */
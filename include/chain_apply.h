@@ -0,0 +1,153 @@
+/**
+ * @file      chain_apply.h
+ *
+ * @brief     Contains the reverse of the chain invoke: navigates through the
+ *            accessors chain and passes the values into the final setter
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__CHAIN_APPLY__H
+#define INCLUDE__CHAIN_APPLY__H
+
+/* Part of the library */
+#include <function_info.h>
+#include <binary_layout.h>
+
+/* STL */
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+using namespace msl;
+    /**
+     * @brief      detail component namespace
+     */
+    namespace detail {
+        /**
+         * @brief      Invokes first Count accessors of the chain, every next
+         *             accessor is invoked for the result of the previous one
+         *
+         * @note       The getters with out-params fill the copies, so the
+         *             values can't be applied through them. Only the
+         *             accessors returning reference or pointer are supported
+         *
+         * @tparam     Count    Number of accessors to invoke
+         * @tparam     f        The first method of the chain
+         * @tparam     rest     The rest methods of the chain
+         * @tparam     TObj     Type of the object
+         *
+         * @param      aObj     Object to start navigation from
+         *
+         * @return     Reference to the object returned by the last accessor
+         */
+        template<size_t Count, auto f, auto ... rest, typename TObj>
+        constexpr decltype(auto) navigatePrefix(TObj & aObj) {
+            if constexpr (0 == Count) {
+                return (aObj);
+            } else {
+                using result_t = decltype((aObj.*f)());
+                static_assert(std::is_lvalue_reference_v<result_t> || std::is_pointer_v<result_t>,
+                              "Only accessors returning reference or pointer can be used to apply the values");
+
+                if constexpr (std::is_pointer_v<result_t>) {
+                    return navigatePrefix<Count - 1, rest...>(*(aObj.*f)());
+                } else {
+                    return navigatePrefix<Count - 1, rest...>((aObj.*f)());
+                }
+            }
+        }
+
+        /**
+         * @brief      Returns the last method of the chain
+         *
+         * @tparam     fx    Methods of the chain
+         */
+        template<auto ... fx>
+        constexpr auto lastMethod() noexcept {
+            return std::get<sizeof...(fx) - 1>(std::tuple{ fx... });
+        }
+
+        /**
+         * @brief      Decodes the setter arguments from the buffer right into
+         *             the setter call, without any intermediate tuple
+         *
+         * @tparam     setter    The setter
+         * @tparam     TObj      Type of the object
+         * @tparam     Idx       Indexes of the setter arguments
+         *
+         * @param      aObj      Object to invoke setter for
+         * @param      aIn       The encoded arguments
+         */
+        template<auto setter, typename TObj, size_t ... Idx>
+        inline void applyEncoded(TObj & aObj, unsigned char const * aIn, std::index_sequence<Idx...>) {
+            using args_t = typename function_info<decltype(setter)>::args;
+
+            constexpr auto OFFSETS { binary_offsets<args_t>::value() };
+            (void)OFFSETS;
+
+            (aObj.*setter)(readLittleEndian<std::decay_t<std::tuple_element_t<Idx, args_t>>>(aIn + OFFSETS[Idx])...);
+        }
+    } /* end of namespace detail */
+
+    /**
+     * @brief      Navigates through all the methods, except the last one, and
+     *             invokes the last one (setter) with the passed arguments
+     *
+     * @tparam     fx      Accessors chain, finished with the setter
+     * @tparam     TObj    Type of the object
+     * @tparam     TArgs   Types of the setter arguments
+     *
+     * @param      aObj    Object to start from
+     * @param      aArgs   Setter arguments
+     */
+    template<auto ... fx, typename TObj, typename ... TArgs>
+    constexpr void chainApply(TObj & aObj, TArgs && ... aArgs) {
+        constexpr auto setter { detail::lastMethod<fx...>() };
+        (detail::navigatePrefix<sizeof...(fx) - 1, fx...>(aObj).*setter)(std::forward<TArgs>(aArgs)...);
+    }
+
+    /**
+     * @brief      Same as above, but the setter arguments are decoded from the
+     *             compact little-endian layout (see binary_acceptor)
+     *
+     * @tparam     fx      Accessors chain, finished with the setter
+     * @tparam     TObj    Type of the object
+     *
+     * @param      aObj    Object to start from
+     * @param      aIn     The encoded setter arguments, shall contain at least
+     *                     binary_size_v of the setter arguments bytes
+     */
+    template<auto ... fx, typename TObj>
+    inline void chainApplyEncoded(TObj & aObj, unsigned char const * aIn) {
+        constexpr auto setter { detail::lastMethod<fx...>() };
+        using args_t = typename function_info<decltype(detail::lastMethod<fx...>())>::args;
+
+        detail::applyEncoded<setter>(detail::navigatePrefix<sizeof...(fx) - 1, fx...>(aObj), aIn,
+                                     std::make_index_sequence<std::tuple_size_v<args_t>>{});
+    }
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__CHAIN_APPLY__H */
@@ -24,8 +24,10 @@
 
 /* Part of the library */
 #include <function_info.h>
+#include <metaprogramming_base.h>
 
 /* STL */
+#include <cstddef>
 #include <tuple>
 #include <array>
 #include <type_traits>
@@ -61,21 +63,196 @@ using namespace msl;
             }
         }
 
+/** @{ */
+/* method meta-function, which unwraps compile-time constant methods */
+        /**
+         * @brief      Returns type of the method, for the runtime methods it's
+         *             the type itself
+         *
+         * @tparam     Fx    Type of the method
+         */
+        template<typename Fx>
+        struct method {
+            using type = Fx;
+        };
+
+        /**
+         * @brief      Overload for the compile-time constant methods
+         *
+         * @tparam     Fx    Type of the method
+         * @tparam     fx    The method itself
+         */
+        template<typename Fx, Fx fx>
+        struct method<std::integral_constant<Fx, fx>> {
+            using type = Fx;
+        };
+
+        /**
+         * @brief      stl's _t standalone type
+         *
+         * @tparam     Fx    Type of the method
+         */
+        template<typename Fx>
+        using method_t = typename method<Fx>::type;
+/** @} */
+
+/** @{ */
+/* step_result meta-function, which returns the tuple type of the step */
+        /**
+         * @brief      Initial definition, the getter returning the value or
+         *             the pointer: the tuple keeps the returned scalar value,
+         *             or refers to the returned class value kept by the step
+         *
+         * @tparam     Fx     Type of the method
+         * @tparam     Ret    Type of the returned value
+         */
+        template<typename Fx, typename Ret = typename function_info<Fx>::ret>
+        struct step_result {
+            using type = std::conditional_t<std::is_class_v<Ret>, std::tuple<Ret &>, std::tuple<Ret>>;
+        };
+
+        /**
+         * @brief      Overload for the getter returning the reference: the
+         *             tuple keeps the reference itself, without any copy
+         *
+         * @tparam     Fx     Type of the method
+         * @tparam     Ret    Type of the returned value
+         */
+        template<typename Fx, typename Ret>
+        struct step_result<Fx, Ret &> {
+            using type = std::tuple<Ret &>;
+        };
+
+        /**
+         * @brief      Overload for the getter returning the rvalue reference,
+         *             the value is moved into the tuple
+         *
+         * @tparam     Fx     Type of the method
+         * @tparam     Ret    Type of the returned value
+         */
+        template<typename Fx, typename Ret>
+        struct step_result<Fx, Ret &&> {
+            using type = std::tuple<Ret>;
+        };
+
+        /**
+         * @brief      Overload for the getter, which fills the out-params: the
+         *             tuple keeps the copies of all the params
+         *
+         * @tparam     Fx     Type of the method
+         */
+        template<typename Fx>
+        struct step_result<Fx, void> {
+            using type = typename function_info<Fx>::stack_args;
+        };
+
+        /**
+         * @brief      stl's _t standalone type
+         *
+         * @tparam     Fx    Type of the method
+         */
+        template<typename Fx>
+        using step_result_t = typename step_result<Fx>::type;
+/** @} */
+
+        /**
+         * @brief      Returns the object to invoke the next method for. The
+         *             result of the getter returning the reference or pointer
+         *             is dereferenced, otherwise the object is taken from the
+         *             tuple by it's type
+         *
+         * @tparam     Cl       Class of the next method
+         * @tparam     Tuple    Type of the step tuple
+         *
+         * @param      aTuple   The step tuple
+         *
+         * @return     Reference to the next object
+         */
+        template<typename Cl, typename Tuple>
+        constexpr decltype(auto) stepObject(Tuple & aTuple) {
+            using first_t = std::tuple_element_t<0, Tuple>;
+
+            if constexpr (1 == std::tuple_size_v<Tuple> && std::is_pointer_v<first_t>) {
+                return (*std::get<0>(aTuple));
+            } else if constexpr (1 == std::tuple_size_v<Tuple> && std::is_reference_v<first_t>) {
+                return (std::get<0>(aTuple));
+            } else {
+                return (std::get<Cl>(aTuple));
+            }
+        }
+
+/** @{ */
+/* step_value meta-function, which keeps the class value returned by the getter */
+        /**
+         * @brief      Initial definition, the step keeps nothing besides the
+         *             tuple
+         *
+         * @tparam     Ret    Type of the returned value
+         */
+        template<typename Ret, typename = void>
+        struct step_value {
+            /**
+             * @brief      Invokes nothing, the tuple gets the result itself
+             */
+            template<typename Fx, typename TFx, typename Obj>
+            static constexpr step_value make(TFx const &, Obj &) {
+                return step_value{ };
+            }
+        };
+
+        /**
+         * @brief      Overload for the class value: it's initialized right
+         *             from the returned value, so it's neither copied nor
+         *             moved, the tuple of the step refers to it
+         *
+         * @tparam     Ret    Type of the returned value
+         */
+        template<typename Ret>
+        struct step_value<Ret, std::enable_if_t<std::is_class_v<Ret>>> {
+            Ret value;
+
+            /**
+             * @brief      Invokes the getter
+             */
+            template<typename Fx, typename TFx, typename Obj>
+            static constexpr step_value make(TFx const & aFx, Obj & obj) {
+                return step_value{ (obj.*static_cast<Fx>(aFx))() };
+            }
+        };
+/** @} */
+
         /**
          * @brief      The invoking step object, which also holds the tuple
          *
+         * @note       Two kinds of getters are supported: `void` getters
+         *             filling the out-params, and getters without params
+         *             returning the value, the reference or the pointer
+         *
+         * @note       The step may refer to itself, so it's neither copied
+         *             nor moved
+         *
          * @tparam     Fx    Type of the method
          */
         template<typename Fx>
-        struct OwningInvokingStep {
-            using tuple_t    = typename function_info<Fx>::stack_args;
+        struct OwningInvokingStep
+            : step_value<typename function_info<Fx>::ret> {
+            using tuple_t    = step_result_t<Fx>;
             using qalified_t = typename function_info<Fx>::args;
             using class_t    = typename function_info<Fx>::cl;
 
-            static constexpr size_t TUPLE_SIZE { std::tuple_size_v<tuple_t> };
+            static constexpr bool   IS_RETURNING { !std::is_void_v<typename function_info<Fx>::ret> };
+            static constexpr size_t TUPLE_SIZE   { std::tuple_size_v<tuple_t> };
+
+            static_assert(!IS_RETURNING || 0 == std::tuple_size_v<qalified_t>,
+                          "Getter shall either return void and fill the params, or have no params and return the value");
+
+            using value_t = step_value<typename function_info<Fx>::ret>;
 
             tuple_t tuple;
 
+            OwningInvokingStep(OwningInvokingStep const &) = delete;
+            OwningInvokingStep & operator=(OwningInvokingStep const &) = delete;
+
             /**
              * @brief      The streaming operator which simply deduces type of
              *             the next class type in a getters chain
@@ -88,32 +265,91 @@ using namespace msl;
              */
             template<typename OpFx>
             constexpr auto operator<<(OpFx const & aFx) && {
-                using invoking_t = typename function_info<OpFx>::cl;
-                return OwningInvokingStep<OpFx>{ aFx, std::get<invoking_t>(tuple) };
+                using invoking_t = typename function_info<method_t<OpFx>>::cl;
+                return OwningInvokingStep<method_t<OpFx>>{ aFx, stepObject<invoking_t>(tuple) };
             }
 
             /**
              * @brief      Creates the invoker and also invokes the function to
              *             fill the tuple with arguments
              *
+             * @tparam     TFx    Type of the method, or of the compile-time
+             *                    constant wrapping the method
              * @tparam     Obj
              */
-            template<typename Obj>
-            explicit constexpr OwningInvokingStep(Fx const & aFx, Obj & obj)
+            template<typename TFx, typename Obj>
+            explicit constexpr OwningInvokingStep(TFx const & aFx, Obj & obj)
+                : OwningInvokingStep { std::bool_constant<IS_RETURNING>{}, aFx, obj }
+            {}
+
+            /**
+             * @brief      Invokes the function to fill the already existing
+             *             tuple with arguments
+             *
+             * @note       The out-params getters only
+             *
+             * @tparam     TFx       Type of the method, or of the compile-time
+             *                       constant wrapping the method
+             * @tparam     Obj
+             *
+             * @param      aTuple    Tuple to fill
+             * @param      aFx       The method
+             * @param      obj       Object to invoke the method for
+             */
+            template<typename TFx, typename Obj>
+            static constexpr void fill(tuple_t & aTuple, TFx const & aFx, Obj & obj) {
+                static_assert(!IS_RETURNING, "Only the out-params getters fill the existing tuple");
+                invokeImpl(std::make_index_sequence<TUPLE_SIZE>{}, aTuple, aFx, obj);
+            }
+        private:
+            /**
+             * @brief      Creates the tuple right from the returned value, or
+             *             refers to the returned class value kept by the step
+             */
+            template<typename TFx, typename Obj>
+            explicit constexpr OwningInvokingStep(std::true_type, TFx const & aFx, Obj & obj)
+                : value_t { value_t::template make<Fx>(aFx, obj) }
+                , tuple   { returnedTuple(aFx, obj) }
+            {}
+
+            /**
+             * @brief      Returns the tuple of the returning getter
+             */
+            template<typename TFx, typename Obj>
+            constexpr tuple_t returnedTuple(TFx const & aFx, Obj & obj) {
+                if constexpr (std::is_class_v<typename function_info<Fx>::ret>) {
+                    (void)aFx;
+                    (void)obj;
+                    return tuple_t{ this->value };
+                } else {
+                    return tuple_t{ (obj.*static_cast<Fx>(aFx))() };
+                }
+            }
+
+            /**
+             * @brief      Creates the tuple and fills it via the out-params
+             */
+            template<typename TFx, typename Obj>
+            explicit constexpr OwningInvokingStep(std::false_type, TFx const & aFx, Obj & obj)
                 : tuple { }
             {
-                this->invokeImpl(std::make_index_sequence<TUPLE_SIZE>{}, aFx, obj);
+                fill(tuple, aFx, obj);
             }
-        private:
+
             /**
              * @brief      The implementation of the invoke, which expands tuple and invokes the
              *
+             * @note       The method is casted to it's real type right here, so
+             *             the compile-time constant methods are visible to the
+             *             inliner
+             *
+             * @tparam     TFx
              * @tparam     Obj
              * @tparam     Idx
              */
-            template<typename Obj, size_t ... Idx>
-            constexpr void invokeImpl(std::index_sequence<Idx...>, Fx const & aFx, Obj & obj) {
-                (obj.*aFx)(conditionalAddressOf<std::tuple_element_t<Idx, qalified_t>>(std::get<Idx>(tuple))...);
+            template<typename TFx, typename Obj, size_t ... Idx>
+            static constexpr void invokeImpl(std::index_sequence<Idx...>, tuple_t & aTuple, TFx const & aFx, Obj & obj) {
+                (obj.*static_cast<Fx>(aFx))(conditionalAddressOf<std::tuple_element_t<Idx, qalified_t>>(std::get<Idx>(aTuple))...);
             }
         };
 
@@ -146,16 +382,84 @@ using namespace msl;
              */
             template<typename OpFx>
             constexpr auto operator<<(OpFx const & aFx) && {
-                using invoking_t = typename function_info<OpFx>::cl;
-                return OwningInvokingStep<OpFx>{ aFx, obj };
+                return OwningInvokingStep<method_t<OpFx>>{ aFx, obj };
             }
         };
+
+/** @{ */
+/* values meta-function, which replaces the references of the result with values */
+        /**
+         * @brief      Initial definition, unused
+         */
+        template<typename Tuple>
+        struct values;
+
+        /**
+         * @brief      Returns the tuple of the values
+         *
+         * @tparam     T    Types of the tuple
+         */
+        template<typename ... T>
+        struct values<std::tuple<T...>> {
+            using type = std::tuple<std::remove_cv_t<std::remove_reference_t<T>>...>;
+        };
+
+        /**
+         * @brief      stl's _t standalone type
+         */
+        template<typename Tuple>
+        using values_t = typename values<Tuple>::type;
+/** @} */
     } /* end of namespace detail */
 
+    /**
+     * @brief      Invokes the chain and passes the result of the last function
+     *             into the callback in place. All the steps are alive during
+     *             the callback, so the references returned by the getters are
+     *             passed as is, and the values are neither copied nor moved
+     *
+     * @tparam     TObj   Type of the object
+     * @tparam     TFn    Type of the callback
+     * @tparam     TFxs   Type of the function
+     *
+     * @param      aObj   Object
+     * @param      aFn    The callback, invoked with the result tuple
+     * @param      aFxs   Functions
+     *
+     * @return     Result of the callback
+     */
+    template<typename TObj, typename TFn, typename ... TFxs>
+    constexpr decltype(auto) chainInvokeWith(TObj & aObj, TFn && aFn, TFxs && ... aFxs) {
+        return std::forward<TFn>(aFn)((detail::FoldingBeginner<TObj>{ aObj } << ... << std::forward<TFxs>(aFxs)).tuple);
+    }
+
+    /**
+     * @brief      Same as above, but the methods are passed as compile-time
+     *             constants, so the whole chain can be inlined
+     *
+     * @tparam     fx     Methods to invoke
+     * @tparam     TObj   Type of the object
+     * @tparam     TFn    Type of the callback
+     *
+     * @param      aObj   Object
+     * @param      aFn    The callback, invoked with the result tuple
+     *
+     * @return     Result of the callback
+     */
+    template<auto ... fx, typename TObj, typename TFn>
+    constexpr decltype(auto) chainInvokeWith(TObj & aObj, TFn && aFn) {
+        return chainInvokeWith(aObj, std::forward<TFn>(aFn), std::integral_constant<decltype(fx), fx>{}...);
+    }
+
     /**
      * @brief      Invoeks the first for the object, second for the result of
      *             the first, third for result of the second an so on
      *
+     * @note       The result is moved out of the last step, and the
+     *             references are replaced with the copies, since the steps
+     *             they may refer to are destroyed. Use chainInvokeWith to
+     *             access the result in place
+     *
      * @tparam     TObj   Type of the object
      * @tparam     TFxs   Type of the function
      *
@@ -166,7 +470,33 @@ using namespace msl;
      */
     template<typename TObj, typename ... TFxs>
     constexpr auto chainInvoke(TObj && aObj, TFxs && ... aFxs) {
-        return (detail::FoldingBeginner<std::decay_t<TObj>>{ aObj } << ... << std::forward<TFxs>(aFxs)).tuple;
+        using last_ret_t = typename function_info<detail::method_t<last_t<std::decay_t<TFxs>...>>>::ret;
+
+        return chainInvokeWith(aObj, [](auto && aResult) {
+            using values_t = detail::values_t<std::decay_t<decltype(aResult)>>;
+            if constexpr (std::is_class_v<last_ret_t>) {
+                /* the returned class value is kept by the last step */
+                return values_t{ std::move(std::get<0>(aResult)) };
+            } else {
+                return values_t{ std::move(aResult) };
+            }
+        }, std::forward<TFxs>(aFxs)...);
+    }
+
+    /**
+     * @brief      Same as above, but the methods are passed as compile-time
+     *             constants, so the whole chain can be inlined
+     *
+     * @tparam     fx     Methods to invoke
+     * @tparam     TObj   Type of the object
+     *
+     * @param      aObj   Object
+     *
+     * @return     Result of the last function
+     */
+    template<auto ... fx, typename TObj>
+    constexpr auto chainInvoke(TObj && aObj) {
+        return chainInvoke(aObj, std::integral_constant<decltype(fx), fx>{}...);
     }
 } /* end of namespace mil */
 
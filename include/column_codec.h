@@ -0,0 +1,736 @@
+/**
+ * @file      column_codec.h
+ *
+ * @brief     Contains the encoding kernels of the integer columns produced by
+ *            the batch invoke: delta with zigzag, group varint and bit
+ *            packing, with AVX2 and SSE4 paths selected in runtime, and the
+ *            scalar fallback
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__COLUMN_CODEC__H
+#define INCLUDE__COLUMN_CODEC__H
+
+/* STL */
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <algorithm>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      The instruction set of the kernels
+     */
+    enum class simd_level : uint8_t {
+        scalar = 0,
+        sse4   = 1,
+        avx2   = 2
+    };
+
+    /**
+     * @brief      detail component namespace
+     */
+    namespace detail {
+        /**
+         * @brief      The tables of the group varint: the shuffle, which
+         *             packs the significant bytes of the 4 values, and the
+         *             number of the packed bytes, by the control byte
+         */
+        struct group_varint_tables {
+            std::array<std::array<uint8_t, 16>, 256>   shuffle { };
+            std::array<uint8_t, 256>                   length  { };
+        };
+
+        /**
+         * @brief      Makes the tables of the group varint
+         */
+        constexpr inline group_varint_tables makeGroupVarintTables() noexcept {
+            group_varint_tables tables { };
+            for (size_t control { 0 }; control < 256; ++control) {
+                size_t pos { 0 };
+                for (size_t lane { 0 }; lane < 4; ++lane) {
+                    size_t const length { ((control >> (2 * lane)) & 3u) + 1 };
+                    for (size_t byte { 0 }; byte < length; ++byte) {
+                        tables.shuffle[control][pos++] = static_cast<uint8_t>(4 * lane + byte);
+                    }
+                }
+                tables.length[control] = static_cast<uint8_t>(pos);
+                for (; pos < 16; ++pos) {
+                    tables.shuffle[control][pos] = 0x80u;
+                }
+            }
+            return tables;
+        }
+
+        inline constexpr group_varint_tables GROUP_VARINT { makeGroupVarintTables() };
+
+        /**
+         * @brief      The layout of the bit packed column: the blocks of
+         *             256 values, `[u8 width][width * 32 bytes]`. The block is
+         *             8 interleaved lanes, value `i` belongs to lane `i % 8`,
+         *             the lane packs it's 32 values into `width` 32-bit words,
+         *             word `k` of lane `l` is the word `k * 8 + l` of the
+         *             block. The last block is padded with zeroes
+         */
+        struct bitpack_layout {
+            static constexpr size_t LANES { 8   };
+            static constexpr size_t BLOCK { 256 };
+        };
+
+        /**
+         * @brief      Returns number of bytes of the value in the group
+         *             varint, minus one
+         *
+         * @param      aValue    The value
+         */
+        constexpr inline uint32_t groupVarintCode(uint32_t aValue) noexcept {
+            return (aValue > 0xffu) + (aValue > 0xffffu) + (aValue > 0xffffffu);
+        }
+
+        /**
+         * @brief      Returns number of the significant bits
+         *
+         * @param      aValue    The value
+         */
+        constexpr inline uint32_t bitWidth(uint32_t aValue) noexcept {
+            uint32_t width { 0 };
+            for (; aValue; aValue >>= 1) {
+                ++width;
+            }
+            return width;
+        }
+
+        /**
+         * @brief      Writes the 32-bit value little-endian
+         */
+        inline void storeWord(unsigned char * aOut, uint32_t aValue) noexcept {
+            for (size_t i { 0 }; i < sizeof(aValue); ++i) {
+                aOut[i] = static_cast<unsigned char>(aValue >> (8u * i));
+            }
+        }
+
+        /**
+         * @brief      Reads the 32-bit little-endian value
+         */
+        inline uint32_t loadWord(unsigned char const * aIn) noexcept {
+            uint32_t value { 0 };
+            for (size_t i { 0 }; i < sizeof(value); ++i) {
+                value |= static_cast<uint32_t>(aIn[i]) << (8u * i);
+            }
+            return value;
+        }
+
+        /**
+         * @brief      Scalar kernels, define the format, all the other
+         *             kernels produce the same bytes
+         */
+        struct scalar_kernels {
+            /**
+             * @brief      Writes the zigzag differences of the neighbour
+             *             values, the first value is subtracted from the base
+             */
+            static void deltaZigzag(int32_t const * aIn, size_t aCount, int32_t aBase, uint32_t * aOut) noexcept {
+                uint32_t previous { static_cast<uint32_t>(aBase) };
+                for (size_t i { 0 }; i < aCount; ++i) {
+                    uint32_t const value { static_cast<uint32_t>(aIn[i]) };
+                    uint32_t const delta { value - previous };
+                    aOut[i]  = (delta << 1) ^ (0u - (delta >> 31));
+                    previous = value;
+                }
+            }
+
+            /**
+             * @brief      Writes the groups of 4 values: the control byte,
+             *             2 bits per value, then the significant bytes of the
+             *             values. The last group has only the present values
+             */
+            static size_t groupVarint(uint32_t const * aIn, size_t aCount, unsigned char * aOut) noexcept {
+                unsigned char * out { aOut };
+                for (size_t i { 0 }; i < aCount; i += 4) {
+                    unsigned char * const control { out++ };
+                    *control = 0;
+                    for (size_t lane { 0 }; lane < 4 && i + lane < aCount; ++lane) {
+                        uint32_t const value { aIn[i + lane] };
+                        uint32_t const code  { groupVarintCode(value) };
+                        *control |= static_cast<unsigned char>(code << (2 * lane));
+                        for (uint32_t byte { 0 }; byte <= code; ++byte) {
+                            *out++ = static_cast<unsigned char>(value >> (8u * byte));
+                        }
+                    }
+                }
+                return static_cast<size_t>(out - aOut);
+            }
+
+            /**
+             * @brief      Packs the single full block
+             */
+            static size_t bitpackBlock(uint32_t const * aIn, unsigned char * aOut) noexcept {
+                uint32_t bits { 0 };
+                for (size_t i { 0 }; i < bitpack_layout::BLOCK; ++i) {
+                    bits |= aIn[i];
+                }
+                uint32_t const width { bitWidth(bits) };
+
+                *aOut = static_cast<unsigned char>(width);
+                unsigned char * const words { aOut + 1 };
+                for (size_t lane { 0 }; lane < bitpack_layout::LANES; ++lane) {
+                    uint32_t acc   { 0 };
+                    uint32_t shift { 0 };
+                    size_t   word  { 0 };
+                    for (size_t j { 0 }; j < bitpack_layout::BLOCK / bitpack_layout::LANES; ++j) {
+                        uint32_t const value { aIn[j * bitpack_layout::LANES + lane] };
+                        acc   |= shift < 32 ? value << shift : 0;
+                        shift += width;
+                        if (shift >= 32) {
+                            storeWord(words + 4 * (word++ * bitpack_layout::LANES + lane), acc);
+                            shift -= 32;
+                            acc    = 0 == shift ? 0 : value >> (width - shift);
+                        }
+                    }
+                }
+                return 1 + width * 32;
+            }
+
+            static size_t bitpack(uint32_t const * aIn, size_t aCount, unsigned char * aOut) noexcept {
+                return bitpackBlocks<scalar_kernels>(aIn, aCount, aOut);
+            }
+
+            /**
+             * @brief      Packs all the blocks, the last one is padded
+             *
+             * @tparam     TKernels    Kernels packing the full block
+             */
+            template<typename TKernels>
+            static size_t bitpackBlocks(uint32_t const * aIn, size_t aCount, unsigned char * aOut) noexcept {
+                size_t size { 0 };
+                size_t i    { 0 };
+                for (; i + bitpack_layout::BLOCK <= aCount; i += bitpack_layout::BLOCK) {
+                    size += TKernels::bitpackBlock(aIn + i, aOut + size);
+                }
+                if (i < aCount) {
+                    uint32_t last[bitpack_layout::BLOCK] { };
+                    std::copy(aIn + i, aIn + aCount, last);
+                    size += TKernels::bitpackBlock(last, aOut + size);
+                }
+                return size;
+            }
+        };
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+        /**
+         * @brief      SSE4.1 kernels, 4 values per step
+         */
+        struct sse4_kernels {
+            __attribute__((target("sse4.1")))
+            static void deltaZigzag(int32_t const * aIn, size_t aCount, int32_t aBase, uint32_t * aOut) noexcept {
+                __m128i previous { _mm_set1_epi32(aBase) };
+                size_t  i        { 0 };
+                for (; i + 4 <= aCount; i += 4) {
+                    __m128i const value { _mm_loadu_si128(reinterpret_cast<__m128i const *>(aIn + i)) };
+                    __m128i const delta { _mm_sub_epi32(value, _mm_alignr_epi8(value, previous, 12)) };
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(aOut + i),
+                                     _mm_xor_si128(_mm_slli_epi32(delta, 1), _mm_srai_epi32(delta, 31)));
+                    previous = value;
+                }
+                scalar_kernels::deltaZigzag(aIn + i, aCount - i, 0 == i ? aBase : aIn[i - 1], aOut + i);
+            }
+
+            /**
+             * @brief      Returns the control byte of the 4 values
+             */
+            __attribute__((target("sse4.1")))
+            static uint32_t control(__m128i aValue) noexcept {
+                __m128i const le1   { _mm_cmpeq_epi32(_mm_min_epu32(aValue, _mm_set1_epi32(0xff)),     aValue) };
+                __m128i const le2   { _mm_cmpeq_epi32(_mm_min_epu32(aValue, _mm_set1_epi32(0xffff)),   aValue) };
+                __m128i const le3   { _mm_cmpeq_epi32(_mm_min_epu32(aValue, _mm_set1_epi32(0xffffff)), aValue) };
+                __m128i const codes { _mm_add_epi32(_mm_set1_epi32(3), _mm_add_epi32(le1, _mm_add_epi32(le2, le3))) };
+                __m128i const bits  { _mm_mullo_epi32(codes, _mm_setr_epi32(1, 4, 16, 64)) };
+                __m128i const bytes { _mm_shuffle_epi8(bits, _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)) };
+                return (static_cast<uint32_t>(_mm_cvtsi128_si32(bytes)) * 0x01010101u) >> 24;
+            }
+
+            /**
+             * @brief      Writes the group of 4 values, writes 17 bytes at
+             *             most, the caller shall provide them
+             */
+            __attribute__((target("sse4.1")))
+            static unsigned char * group(__m128i aValue, uint32_t aControl, unsigned char * aOut) noexcept {
+                __m128i const shuffle { _mm_loadu_si128(reinterpret_cast<__m128i const *>(GROUP_VARINT.shuffle[aControl].data())) };
+                *aOut = static_cast<unsigned char>(aControl);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(aOut + 1), _mm_shuffle_epi8(aValue, shuffle));
+                return aOut + 1 + GROUP_VARINT.length[aControl];
+            }
+
+            __attribute__((target("sse4.1")))
+            static size_t groupVarint(uint32_t const * aIn, size_t aCount, unsigned char * aOut) noexcept {
+                unsigned char * out { aOut };
+                size_t          i   { 0 };
+                for (; i + 4 <= aCount; i += 4) {
+                    __m128i const value { _mm_loadu_si128(reinterpret_cast<__m128i const *>(aIn + i)) };
+                    out = group(value, control(value), out);
+                }
+                return static_cast<size_t>(out - aOut) + scalar_kernels::groupVarint(aIn + i, aCount - i, out);
+            }
+
+            __attribute__((target("sse4.1")))
+            static size_t bitpackBlock(uint32_t const * aIn, unsigned char * aOut) noexcept {
+                __m128i const * const in { reinterpret_cast<__m128i const *>(aIn) };
+
+                __m128i bits { _mm_setzero_si128() };
+                for (size_t i { 0 }; i < bitpack_layout::BLOCK / 4; ++i) {
+                    bits = _mm_or_si128(bits, _mm_loadu_si128(in + i));
+                }
+                bits = _mm_or_si128(bits, _mm_srli_si128(bits, 8));
+                bits = _mm_or_si128(bits, _mm_srli_si128(bits, 4));
+                uint32_t const width { bitWidth(static_cast<uint32_t>(_mm_cvtsi128_si32(bits))) };
+
+                *aOut = static_cast<unsigned char>(width);
+                __m128i * const words { reinterpret_cast<__m128i *>(aOut + 1) };
+                for (size_t half { 0 }; half < 2; ++half) {
+                    __m128i  acc   { _mm_setzero_si128() };
+                    uint32_t shift { 0 };
+                    size_t   word  { 0 };
+                    for (size_t j { 0 }; j < bitpack_layout::BLOCK / bitpack_layout::LANES; ++j) {
+                        __m128i const value { _mm_loadu_si128(in + 2 * j + half) };
+                        acc    = _mm_or_si128(acc, _mm_sll_epi32(value, _mm_cvtsi32_si128(static_cast<int>(shift))));
+                        shift += width;
+                        if (shift >= 32) {
+                            _mm_storeu_si128(words + 2 * word++ + half, acc);
+                            shift -= 32;
+                            acc    = _mm_srl_epi32(value, _mm_cvtsi32_si128(static_cast<int>(0 == shift ? 32 : width - shift)));
+                        }
+                    }
+                }
+                return 1 + width * 32;
+            }
+
+            __attribute__((target("sse4.1")))
+            static size_t bitpack(uint32_t const * aIn, size_t aCount, unsigned char * aOut) noexcept {
+                return scalar_kernels::bitpackBlocks<sse4_kernels>(aIn, aCount, aOut);
+            }
+        };
+
+        /**
+         * @brief      AVX2 kernels, 8 values per step
+         */
+        struct avx2_kernels {
+            __attribute__((target("avx2")))
+            static void deltaZigzag(int32_t const * aIn, size_t aCount, int32_t aBase, uint32_t * aOut) noexcept {
+                __m256i const rotate   { _mm256_setr_epi32(7, 0, 1, 2, 3, 4, 5, 6) };
+                __m256i       previous { _mm256_set1_epi32(aBase) };
+                size_t        i        { 0 };
+                for (; i + 8 <= aCount; i += 8) {
+                    __m256i const value   { _mm256_loadu_si256(reinterpret_cast<__m256i const *>(aIn + i)) };
+                    __m256i const shifted { _mm256_blend_epi32(_mm256_permutevar8x32_epi32(value, rotate),
+                                                               _mm256_permutevar8x32_epi32(previous, rotate), 0x01) };
+                    __m256i const delta   { _mm256_sub_epi32(value, shifted) };
+                    _mm256_storeu_si256(reinterpret_cast<__m256i *>(aOut + i),
+                                        _mm256_xor_si256(_mm256_slli_epi32(delta, 1), _mm256_srai_epi32(delta, 31)));
+                    previous = value;
+                }
+                scalar_kernels::deltaZigzag(aIn + i, aCount - i, 0 == i ? aBase : aIn[i - 1], aOut + i);
+            }
+
+            __attribute__((target("avx2")))
+            static size_t groupVarint(uint32_t const * aIn, size_t aCount, unsigned char * aOut) noexcept {
+                unsigned char * out { aOut };
+                size_t          i   { 0 };
+                for (; i + 8 <= aCount; i += 8) {
+                    __m256i const value { _mm256_loadu_si256(reinterpret_cast<__m256i const *>(aIn + i)) };
+                    __m256i const le1   { _mm256_cmpeq_epi32(_mm256_min_epu32(value, _mm256_set1_epi32(0xff)),     value) };
+                    __m256i const le2   { _mm256_cmpeq_epi32(_mm256_min_epu32(value, _mm256_set1_epi32(0xffff)),   value) };
+                    __m256i const le3   { _mm256_cmpeq_epi32(_mm256_min_epu32(value, _mm256_set1_epi32(0xffffff)), value) };
+                    __m256i const codes { _mm256_add_epi32(_mm256_set1_epi32(3), _mm256_add_epi32(le1, _mm256_add_epi32(le2, le3))) };
+                    __m256i const bits  { _mm256_sllv_epi32(codes, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)) };
+                    __m256i const sads  { _mm256_sad_epu8(bits, _mm256_setzero_si256()) };
+                    __m256i const sums  { _mm256_add_epi64(sads, _mm256_srli_si256(sads, 8)) };
+
+                    uint32_t const control0 { static_cast<uint32_t>(_mm_cvtsi128_si32(_mm256_castsi256_si128(sums)))      };
+                    uint32_t const control1 { static_cast<uint32_t>(_mm_cvtsi128_si32(_mm256_extracti128_si256(sums, 1))) };
+
+                    __m256i const shuffle { _mm256_inserti128_si256(
+                        _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(GROUP_VARINT.shuffle[control0].data()))),
+                        _mm_loadu_si128(reinterpret_cast<__m128i const *>(GROUP_VARINT.shuffle[control1].data())), 1) };
+                    __m256i const packed  { _mm256_shuffle_epi8(value, shuffle) };
+
+                    *out = static_cast<unsigned char>(control0);
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 1), _mm256_castsi256_si128(packed));
+                    out += 1 + GROUP_VARINT.length[control0];
+                    *out = static_cast<unsigned char>(control1);
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 1), _mm256_extracti128_si256(packed, 1));
+                    out += 1 + GROUP_VARINT.length[control1];
+                }
+                return static_cast<size_t>(out - aOut) + scalar_kernels::groupVarint(aIn + i, aCount - i, out);
+            }
+
+            __attribute__((target("avx2")))
+            static size_t bitpackBlock(uint32_t const * aIn, unsigned char * aOut) noexcept {
+                __m256i const * const in { reinterpret_cast<__m256i const *>(aIn) };
+
+                __m256i bits { _mm256_setzero_si256() };
+                for (size_t i { 0 }; i < bitpack_layout::BLOCK / 8; ++i) {
+                    bits = _mm256_or_si256(bits, _mm256_loadu_si256(in + i));
+                }
+                __m128i half { _mm_or_si128(_mm256_castsi256_si128(bits), _mm256_extracti128_si256(bits, 1)) };
+                half = _mm_or_si128(half, _mm_srli_si128(half, 8));
+                half = _mm_or_si128(half, _mm_srli_si128(half, 4));
+                uint32_t const width { bitWidth(static_cast<uint32_t>(_mm_cvtsi128_si32(half))) };
+
+                *aOut = static_cast<unsigned char>(width);
+                __m256i * const words { reinterpret_cast<__m256i *>(aOut + 1) };
+                __m256i  acc   { _mm256_setzero_si256() };
+                uint32_t shift { 0 };
+                size_t   word  { 0 };
+                for (size_t j { 0 }; j < bitpack_layout::BLOCK / bitpack_layout::LANES; ++j) {
+                    __m256i const value { _mm256_loadu_si256(in + j) };
+                    acc    = _mm256_or_si256(acc, _mm256_sll_epi32(value, _mm_cvtsi32_si128(static_cast<int>(shift))));
+                    shift += width;
+                    if (shift >= 32) {
+                        _mm256_storeu_si256(words + word++, acc);
+                        shift -= 32;
+                        acc    = _mm256_srl_epi32(value, _mm_cvtsi32_si128(static_cast<int>(0 == shift ? 32 : width - shift)));
+                    }
+                }
+                return 1 + width * 32;
+            }
+
+            __attribute__((target("avx2")))
+            static size_t bitpack(uint32_t const * aIn, size_t aCount, unsigned char * aOut) noexcept {
+                return scalar_kernels::bitpackBlocks<avx2_kernels>(aIn, aCount, aOut);
+            }
+        };
+#endif
+
+        /**
+         * @brief      Returns the best instruction set supported by the CPU,
+         *             detected once
+         */
+        inline simd_level detectSimdLevel() noexcept {
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+            static simd_level const level { []() noexcept {
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx2")) {
+                    return simd_level::avx2;
+                }
+                if (__builtin_cpu_supports("sse4.1")) {
+                    return simd_level::sse4;
+                }
+                return simd_level::scalar;
+            }() };
+            return level;
+#else
+            return simd_level::scalar;
+#endif
+        }
+    } /* end of namespace detail */
+
+    /**
+     * @brief      The encoder of the integer columns, e.g. the columns of
+     *             the batch invoke. The kernels are selected once, when the
+     *             codec is created, the output doesn't depend on them
+     *
+     * @note       The group varint writes the groups of 4 values, the
+     *             control byte with 2 bits per value (number of bytes minus
+     *             one) followed by the significant bytes of the values,
+     *             little-endian. The bit packing writes the blocks described
+     *             by detail::bitpack_layout. The delta kernels write the
+     *             zigzag differences of the neighbour values, so the slowly
+     *             changing counters and timestamps take 1-2 bytes or few
+     *             bits. The output buffers shall have the size returned by
+     *             the bound functions, the kernels write whole vectors and
+     *             never check the bounds. The decoders are scalar
+     */
+    class column_codec {
+    public:
+        /**
+         * @brief      Creates the codec with the best supported kernels
+         */
+        column_codec() noexcept
+            : column_codec(detail::detectSimdLevel())
+        {}
+
+        /**
+         * @brief      Creates the codec with the kernels of the instruction
+         *             set, it's lowered to the supported one
+         *
+         * @param      aLevel    The instruction set
+         */
+        explicit column_codec(simd_level aLevel) noexcept {
+            m_level = std::min(aLevel, detail::detectSimdLevel());
+            switch (m_level) {
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+            case simd_level::avx2: this->use<detail::avx2_kernels>();   break;
+            case simd_level::sse4: this->use<detail::sse4_kernels>();   break;
+#endif
+            default:               this->use<detail::scalar_kernels>(); break;
+            }
+        }
+
+        /**
+         * @brief      Returns the instruction set of the kernels
+         */
+        simd_level level() const noexcept {
+            return m_level;
+        }
+
+        /**
+         * @brief      Returns the maximal size of the group varint of the
+         *             values, including the slack of the vector stores
+         */
+        static constexpr size_t groupVarintBound(size_t aCount) noexcept {
+            return aCount * sizeof(uint32_t) + (aCount + 3) / 4 + 16;
+        }
+
+        /**
+         * @brief      Returns the maximal size of the bit packed values
+         */
+        static constexpr size_t bitpackBound(size_t aCount) noexcept {
+            return (aCount + detail::bitpack_layout::BLOCK - 1) / detail::bitpack_layout::BLOCK
+                 * (1 + detail::bitpack_layout::BLOCK * sizeof(uint32_t));
+        }
+
+        /**
+         * @brief      Writes the zigzag differences of the neighbour values
+         *
+         * @param      aIn       The values
+         * @param      aCount    Number of the values
+         * @param      aOut      The differences, aCount values
+         * @param      aBase     The value preceding the first one
+         */
+        void deltaZigzag(int32_t const * aIn, size_t aCount, uint32_t * aOut, int32_t aBase = 0) const noexcept {
+            m_deltaZigzag(aIn, aCount, aBase, aOut);
+        }
+
+        /**
+         * @brief      Writes the group varint of the values
+         *
+         * @return     Number of the written bytes
+         */
+        size_t groupVarint(uint32_t const * aIn, size_t aCount, unsigned char * aOut) const noexcept {
+            return m_groupVarint(aIn, aCount, aOut);
+        }
+
+        /**
+         * @brief      Writes the bit packed values
+         *
+         * @return     Number of the written bytes
+         */
+        size_t bitpack(uint32_t const * aIn, size_t aCount, unsigned char * aOut) const noexcept {
+            return m_bitpack(aIn, aCount, aOut);
+        }
+
+        /**
+         * @brief      Writes the group varint of the zigzag differences, the
+         *             values are transformed by the chunks, which stay in L1
+         *
+         * @return     Number of the written bytes, groupVarintBound() at most
+         */
+        size_t deltaVarint(int32_t const * aIn, size_t aCount, unsigned char * aOut, int32_t aBase = 0) const noexcept {
+            return this->chunked(aIn, aCount, aOut, aBase, m_groupVarint);
+        }
+
+        /**
+         * @brief      Writes the bit packed zigzag differences
+         *
+         * @return     Number of the written bytes, bitpackBound() at most
+         */
+        size_t deltaBitpack(int32_t const * aIn, size_t aCount, unsigned char * aOut, int32_t aBase = 0) const noexcept {
+            return this->chunked(aIn, aCount, aOut, aBase, m_bitpack);
+        }
+
+        /**
+         * @brief      Restores the values from the zigzag differences
+         *
+         * @param      aIn       The differences
+         * @param      aCount    Number of the values
+         * @param      aOut      The values
+         * @param      aBase     The value preceding the first one
+         */
+        static void undeltaZigzag(uint32_t const * aIn, size_t aCount, int32_t * aOut, int32_t aBase = 0) noexcept {
+            uint32_t previous { static_cast<uint32_t>(aBase) };
+            for (size_t i { 0 }; i < aCount; ++i) {
+                previous += (aIn[i] >> 1) ^ (0u - (aIn[i] & 1u));
+                aOut[i]   = static_cast<int32_t>(previous);
+            }
+        }
+
+        /**
+         * @brief      Reads the group varint
+         *
+         * @param      aIn       The encoded values
+         * @param      aSize     Size of the encoded values
+         * @param      aOut      The values
+         * @param      aCount    Number of the values
+         *
+         * @return     Number of the read bytes, zero if the input is
+         *             truncated
+         */
+        static size_t groupVarintDecode(unsigned char const * aIn, size_t aSize, uint32_t * aOut, size_t aCount) noexcept {
+            size_t pos { 0 };
+            for (size_t i { 0 }; i < aCount; i += 4) {
+                if (pos >= aSize) {
+                    return 0;
+                }
+                uint32_t const control { aIn[pos++] };
+                for (size_t lane { 0 }; lane < 4 && i + lane < aCount; ++lane) {
+                    size_t const length { ((control >> (2 * lane)) & 3u) + 1 };
+                    if (length > aSize - pos) {
+                        return 0;
+                    }
+                    uint32_t value { 0 };
+                    for (size_t byte { 0 }; byte < length; ++byte) {
+                        value |= static_cast<uint32_t>(aIn[pos++]) << (8u * byte);
+                    }
+                    aOut[i + lane] = value;
+                }
+            }
+            return pos;
+        }
+
+        /**
+         * @brief      Reads the bit packed values
+         *
+         * @return     Number of the read bytes, zero if the input is
+         *             truncated or malformed
+         */
+        static size_t bitpackDecode(unsigned char const * aIn, size_t aSize, uint32_t * aOut, size_t aCount) noexcept {
+            constexpr size_t LANES { detail::bitpack_layout::LANES };
+            constexpr size_t BLOCK { detail::bitpack_layout::BLOCK };
+
+            size_t pos { 0 };
+            for (size_t i { 0 }; i < aCount; i += BLOCK) {
+                if (pos >= aSize || aIn[pos] > 32 || 1 + aIn[pos] * 32u > aSize - pos) {
+                    return 0;
+                }
+                uint32_t const              width { aIn[pos]      };
+                unsigned char const * const words { aIn + pos + 1 };
+                uint32_t const              mask  { 32 == width ? ~0u : (1u << width) - 1 };
+                for (size_t j { 0 }; j < BLOCK && i + j < aCount; ++j) {
+                    size_t const lane  { j % LANES          };
+                    size_t const bit   { (j / LANES) * width };
+                    size_t const word  { bit / 32           };
+                    size_t const shift { bit % 32           };
+
+                    uint64_t value { 0 };
+                    if (0 != width) {
+                        value = detail::loadWord(words + 4 * (word * LANES + lane));
+                        if (shift + width > 32) {
+                            value |= static_cast<uint64_t>(detail::loadWord(words + 4 * ((word + 1) * LANES + lane))) << 32;
+                        }
+                    }
+                    aOut[i + j] = static_cast<uint32_t>(value >> shift) & mask;
+                }
+                pos += 1 + width * 32;
+            }
+            return pos;
+        }
+
+        /**
+         * @brief      Reads the group varint of the zigzag differences
+         *
+         * @return     Number of the read bytes, zero if the input is
+         *             truncated
+         */
+        static size_t deltaVarintDecode(unsigned char const * aIn, size_t aSize, int32_t * aOut, size_t aCount, int32_t aBase = 0) noexcept {
+            return chunkedDecode(aIn, aSize, aOut, aCount, aBase, &groupVarintDecode);
+        }
+
+        /**
+         * @brief      Reads the bit packed zigzag differences
+         *
+         * @return     Number of the read bytes, zero if the input is
+         *             truncated or malformed
+         */
+        static size_t deltaBitpackDecode(unsigned char const * aIn, size_t aSize, int32_t * aOut, size_t aCount, int32_t aBase = 0) noexcept {
+            return chunkedDecode(aIn, aSize, aOut, aCount, aBase, &bitpackDecode);
+        }
+    private:
+        using delta_fn_t  = void(*)(int32_t const *, size_t, int32_t, uint32_t *);
+        using encode_fn_t = size_t(*)(uint32_t const *, size_t, unsigned char *);
+        using decode_fn_t = size_t(*)(unsigned char const *, size_t, uint32_t *, size_t);
+
+        /**
+         * @brief      Number of the values transformed at once, multiple of
+         *             the group and the block
+         */
+        static constexpr size_t CHUNK { detail::bitpack_layout::BLOCK };
+
+        /**
+         * @brief      Uses the kernels
+         *
+         * @tparam     TKernels    The kernels
+         */
+        template<typename TKernels>
+        void use() noexcept {
+            m_deltaZigzag = &TKernels::deltaZigzag;
+            m_groupVarint = &TKernels::groupVarint;
+            m_bitpack     = &TKernels::bitpack;
+        }
+
+        /**
+         * @brief      Encodes the zigzag differences chunk by chunk
+         */
+        size_t chunked(int32_t const * aIn, size_t aCount, unsigned char * aOut, int32_t aBase, encode_fn_t aEncode) const noexcept {
+            uint32_t deltas[CHUNK];
+            size_t   size { 0 };
+            for (size_t i { 0 }; i < aCount; i += CHUNK) {
+                size_t const count { std::min(CHUNK, aCount - i) };
+                m_deltaZigzag(aIn + i, count, 0 == i ? aBase : aIn[i - 1], deltas);
+                size += aEncode(deltas, count, aOut + size);
+            }
+            return size;
+        }
+
+        /**
+         * @brief      Decodes the zigzag differences chunk by chunk
+         */
+        static size_t chunkedDecode(unsigned char const * aIn, size_t aSize, int32_t * aOut, size_t aCount, int32_t aBase,
+                                    decode_fn_t aDecode) noexcept {
+            uint32_t deltas[CHUNK];
+            size_t   pos { 0 };
+            for (size_t i { 0 }; i < aCount; i += CHUNK) {
+                size_t const count { std::min(CHUNK, aCount - i) };
+                size_t const read  { aDecode(aIn + pos, aSize - pos, deltas, count) };
+                if (0 == read) {
+                    return 0;
+                }
+                undeltaZigzag(deltas, count, aOut + i, 0 == i ? aBase : aOut[i - 1]);
+                pos += read;
+            }
+            return pos;
+        }
+
+        simd_level    m_level       { simd_level::scalar };
+        delta_fn_t    m_deltaZigzag { nullptr            };
+        encode_fn_t   m_groupVarint { nullptr            };
+        encode_fn_t   m_bitpack     { nullptr            };
+    };
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__COLUMN_CODEC__H */
@@ -0,0 +1,310 @@
+/**
+ * @file      delta_state.h
+ *
+ * @brief     Contains the per-object state of the delta snapshots, and the
+ *            hashing of the methods chain results
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__DELTA_STATE__H
+#define INCLUDE__DELTA_STATE__H
+
+/* library parts */
+#include <field_mask.h>
+
+/* STL */
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <tuple>
+#include <utility>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      Returns true, if valueHash supports the type
+     *
+     * @tparam     T    Type of the value
+     */
+    template<typename T>
+    struct is_value_hashable;
+
+    /**
+     * @brief      detail component namespace
+     */
+    namespace detail {
+        /**
+         * @brief      Mixes the next word into the hash
+         *
+         * @param      aHash     The hash
+         * @param      aValue    The next word
+         *
+         * @return     The new hash
+         */
+        constexpr inline uint64_t hashMix(uint64_t aHash, uint64_t aValue) noexcept {
+            aValue *= 0xff51afd7ed558ccdull;
+            aValue ^= aValue >> 33;
+            return (aHash ^ aValue) * 0x100000001b3ull + 0x9e3779b97f4a7c15ull;
+        }
+
+/** @{ */
+/* has_delta_hash meta-function */
+        /**
+         * @brief      Initial definition, there is no user hash for the type
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T, typename = void>
+        struct has_delta_hash : std::false_type {};
+
+        /**
+         * @brief      Overload for the types with `uint64_t deltaHash(T const &)`
+         *             found by ADL
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T>
+        struct has_delta_hash<T, std::void_t<decltype(uint64_t{ deltaHash(std::declval<T const &>()) })>>
+            : std::true_type {};
+/** @} */
+
+/** @{ */
+/* is_hashable_range meta-function */
+        /**
+         * @brief      Initial definition, the type isn't a range
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T, typename = void>
+        struct is_hashable_range : std::false_type {};
+
+        /**
+         * @brief      Overload for the types with begin/end
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T>
+        struct is_hashable_range<T, std::void_t<decltype(std::begin(std::declval<T const &>())),
+                                                decltype(std::end(std::declval<T const &>()))>>
+            : std::true_type {};
+/** @} */
+
+/** @{ */
+/* is_contiguous_bytes meta-function */
+        /**
+         * @brief      Initial definition, the type isn't a contiguous range of
+         *             arithmetic values
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T, typename = void>
+        struct is_contiguous_bytes : std::false_type {};
+
+        /**
+         * @brief      Overload for the contiguous ranges (strings, vectors,
+         *             arrays) of the arithmetic values, hashed as raw bytes
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T>
+        struct is_contiguous_bytes<T, std::void_t<decltype(std::data(std::declval<T const &>())),
+                                                  decltype(std::size(std::declval<T const &>()))>>
+            : std::is_arithmetic<std::remove_cv_t<std::remove_pointer_t<decltype(std::data(std::declval<T const &>()))>>> {};
+/** @} */
+
+/** @{ */
+/* hashable_elements meta-function */
+        /**
+         * @brief      Initial definition, the type has no elements
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T, typename = void>
+        struct hashable_elements : std::false_type {};
+
+        /**
+         * @brief      Overload for the ranges, all the elements shall be
+         *             hashable
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T>
+        struct hashable_elements<T, std::enable_if_t<is_hashable_range<T>::value>>
+            : is_value_hashable<std::decay_t<decltype(*std::begin(std::declval<T const &>()))>> {};
+
+        /**
+         * @brief      Overload for the tuples
+         *
+         * @tparam     T    Types of the tuple
+         */
+        template<typename ... T>
+        struct hashable_elements<std::tuple<T...>>
+            : std::conjunction<is_value_hashable<std::decay_t<T>>...> {};
+
+        /**
+         * @brief      Overload for the pairs
+         *
+         * @tparam     T    Types of the pair
+         */
+        template<typename T1, typename T2>
+        struct hashable_elements<std::pair<T1, T2>>
+            : std::conjunction<is_value_hashable<std::decay_t<T1>>, is_value_hashable<std::decay_t<T2>>> {};
+/** @} */
+
+        /**
+         * @brief      Returns number of the significant bytes of the value:
+         *             the x87 extended precision keeps 10 bytes, the rest of
+         *             the long double is the padding with any bits
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T>
+        constexpr size_t significantBytes() noexcept {
+            if constexpr (std::is_floating_point_v<T>) {
+                if constexpr (64 == std::numeric_limits<T>::digits && sizeof(T) > 10) {
+                    return 10;
+                }
+            }
+            return sizeof(T);
+        }
+
+        /**
+         * @brief      Hashes the raw bytes
+         *
+         * @param      aData    The bytes
+         * @param      aSize    Number of the bytes
+         * @param      aHash    The initial hash
+         */
+        inline uint64_t hashBytes(void const * aData, size_t aSize, uint64_t aHash) noexcept {
+            auto const * bytes { static_cast<unsigned char const *>(aData) };
+            for (; aSize >= sizeof(uint64_t); aSize -= sizeof(uint64_t), bytes += sizeof(uint64_t)) {
+                uint64_t word { 0 };
+                std::memcpy(&word, bytes, sizeof(word));
+                aHash = hashMix(aHash, word);
+            }
+            uint64_t tail { 0 };
+            if (0 != aSize) {
+                std::memcpy(&tail, bytes, aSize);
+            }
+            return hashMix(aHash, tail);
+        }
+    } /* end of namespace detail */
+
+/** @{ */
+/* is_value_hashable meta-function */
+    /**
+     * @brief      The user types with the deltaHash, arithmetic values, enums,
+     *             pointers, and the ranges and tuples of the hashable values
+     *
+     * @tparam     T    Type of the value
+     */
+    template<typename T>
+    struct is_value_hashable
+        : std::disjunction<detail::has_delta_hash<T>,
+                           std::is_arithmetic<T>,
+                           std::is_enum<T>,
+                           std::is_pointer<T>,
+                           detail::hashable_elements<T>> {};
+
+    /**
+     * @brief      stl's _v standalone value
+     *
+     * @tparam     T    Type of the value
+     */
+    template<typename T>
+    constexpr bool is_value_hashable_v = is_value_hashable<T>::value;
+/** @} */
+
+    /**
+     * @brief      Returns the 64-bit hash of the value. The user types are
+     *             hashed by `uint64_t deltaHash(T const &)` found by ADL, the
+     *             arithmetic values, enums and pointers by their bits, the
+     *             ranges and tuples element by element
+     *
+     * @param      aValue    The value
+     *
+     * @return     The hash
+     */
+    template<typename T>
+    uint64_t valueHash(T const & aValue) noexcept {
+        static_assert(is_value_hashable_v<T>, "Provide uint64_t deltaHash(T const &) for the type");
+
+        if constexpr (detail::has_delta_hash<T>::value) {
+            return deltaHash(aValue);
+        } else if constexpr ((std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>) && sizeof(T) <= sizeof(uint64_t)) {
+            uint64_t bits { 0 };
+            std::memcpy(&bits, &aValue, sizeof(T));
+            return detail::hashMix(0, bits);
+        } else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>) {
+            /* the wider values: long double, __int128 */
+            return detail::hashBytes(&aValue, detail::significantBytes<T>(), 0);
+        } else if constexpr (detail::is_contiguous_bytes<T>::value) {
+            auto const size { static_cast<size_t>(std::size(aValue)) };
+            return detail::hashBytes(std::data(aValue), size * sizeof(*std::data(aValue)), size);
+        } else if constexpr (detail::is_hashable_range<T>::value) {
+            uint64_t hash { 0 };
+            for (auto const & element: aValue) {
+                hash = detail::hashMix(hash, valueHash(element));
+            }
+            return hash;
+        } else {
+            return std::apply([](auto const & ... aElements) {
+                uint64_t hash { 0 };
+                ((hash = detail::hashMix(hash, valueHash(aElements))), ...);
+                return hash;
+            }, aValue);
+        }
+    }
+
+    /**
+     * @brief      The per-object state of the delta snapshots: the hash of
+     *             the last emitted result of every invoker and the mask of
+     *             the invokers emitted at least once. All the state is kept
+     *             in the single flat block, indexed in the registration order
+     *
+     * @note       The state shall be used with the same object every time,
+     *             the results are compared by 64-bit hashes, so the hash
+     *             collision hides the change
+     *
+     * @tparam     N    Number of the invokers
+     */
+    template<size_t N>
+    struct delta_state {
+        std::array<uint64_t, N>   hashes  { };
+        field_mask<N>             emitted { };
+
+        /**
+         * @brief      Forgets all the emitted results, so the next delta
+         *             snapshot emits everything
+         */
+        constexpr void reset() noexcept {
+            emitted.clear();
+        }
+    };
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__DELTA_STATE__H */
@@ -0,0 +1,287 @@
+/**
+ * @file      field_mask.h
+ *
+ * @brief     Contains the fixed-size bitmap of the invokers, indexed in the
+ *            registration order
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__FIELD_MASK__H
+#define INCLUDE__FIELD_MASK__H
+
+/* STL */
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <initializer_list>
+#include <type_traits>
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      detail component namespace
+     */
+    namespace detail {
+        /**
+         * @brief      Returns index of the lowest set bit
+         *
+         * @param      aWord    The word, shall not be zero
+         */
+        constexpr inline size_t countTrailingZeros(uint64_t aWord) noexcept {
+#if defined(__GNUC__)
+            return static_cast<size_t>(__builtin_ctzll(aWord));
+#else
+            size_t count { 0 };
+            for (; 0 == (aWord & 1u); aWord >>= 1) {
+                ++count;
+            }
+            return count;
+#endif
+        }
+
+        /**
+         * @brief      Returns number of the zero bits above the highest set bit
+         *
+         * @param      aWord    The word, shall not be zero
+         */
+        constexpr inline size_t countLeadingZeros(uint64_t aWord) noexcept {
+#if defined(__GNUC__)
+            return static_cast<size_t>(__builtin_clzll(aWord));
+#else
+            size_t count { 0 };
+            for (; 0 == (aWord & (uint64_t{ 1 } << 63)); aWord <<= 1) {
+                ++count;
+            }
+            return count;
+#endif
+        }
+
+        /**
+         * @brief      Returns number of the set bits
+         *
+         * @param      aWord    The word
+         */
+        constexpr inline size_t countBits(uint64_t aWord) noexcept {
+#if defined(__GNUC__)
+            return static_cast<size_t>(__builtin_popcountll(aWord));
+#else
+            size_t count { 0 };
+            for (; 0 != aWord; aWord &= aWord - 1) {
+                ++count;
+            }
+            return count;
+#endif
+        }
+    } /* end of namespace detail */
+
+    /**
+     * @brief      The bitmap of the invokers, bit `i` corresponds to the
+     *             invoker `i` in the registration order
+     *
+     * @tparam     N    Number of the invokers
+     */
+    template<size_t N>
+    struct field_mask {
+    public:
+        static constexpr size_t WORD_BITS { 64 };
+        static constexpr size_t WORDS     { (N + WORD_BITS - 1) / WORD_BITS };
+
+        /**
+         * @brief      Creates the empty mask
+         */
+        constexpr field_mask() noexcept = default;
+
+        /**
+         * @brief      Creates the mask with the listed bits set, the indexes
+         *             out of the range are ignored
+         *
+         * @param      aIndexes    Indexes of the invokers
+         */
+        constexpr field_mask(std::initializer_list<size_t> aIndexes) noexcept {
+            for (auto const idx: aIndexes) {
+                this->set(idx);
+            }
+        }
+
+        /**
+         * @brief      Returns the mask with all the bits set
+         */
+        static constexpr field_mask all() noexcept {
+            field_mask mask { };
+            for (size_t i { 0 }; i < N; ++i) {
+                mask.set(i);
+            }
+            return mask;
+        }
+
+        /**
+         * @brief      Sets the bit, the index out of the range is ignored, so
+         *             the bits above N are never set
+         *
+         * @param      aIdx    Index of the invoker
+         */
+        constexpr void set(size_t aIdx) noexcept {
+            if (aIdx < N) {
+                m_words[aIdx / WORD_BITS] |= uint64_t{ 1 } << (aIdx % WORD_BITS);
+            }
+        }
+
+        /**
+         * @brief      Clears the bit, the index out of the range is ignored
+         *
+         * @param      aIdx    Index of the invoker
+         */
+        constexpr void reset(size_t aIdx) noexcept {
+            if (aIdx < N) {
+                m_words[aIdx / WORD_BITS] &= ~(uint64_t{ 1 } << (aIdx % WORD_BITS));
+            }
+        }
+
+        /**
+         * @brief      Clears all the bits
+         */
+        constexpr void clear() noexcept {
+            for (auto & word: m_words) {
+                word = 0;
+            }
+        }
+
+        /**
+         * @brief      Returns true, if the bit is set, false for the index out
+         *             of the range
+         *
+         * @param      aIdx    Index of the invoker
+         */
+        constexpr bool test(size_t aIdx) const noexcept {
+            return aIdx < N && 0 != (m_words[aIdx / WORD_BITS] & (uint64_t{ 1 } << (aIdx % WORD_BITS)));
+        }
+
+        /**
+         * @brief      Returns number of the set bits
+         */
+        constexpr size_t count() const noexcept {
+            size_t count { 0 };
+            for (auto const word: m_words) {
+                count += detail::countBits(word);
+            }
+            return count;
+        }
+
+        /**
+         * @brief      Returns true, if any bit is set
+         */
+        constexpr bool any() const noexcept {
+            for (auto const word: m_words) {
+                if (0 != word) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief      Invokes the callback for every set bit in the ascending
+         *             order. The cost depends on the number of the set bits
+         *             and the words, not on the number of the invokers
+         *
+         * @param      aFn    The callback, invoked with the bit index
+         */
+        template<typename TFn>
+        constexpr void forEach(TFn && aFn) const {
+            for (size_t w { 0 }; w < WORDS; ++w) {
+                for (uint64_t word { m_words[w] }; 0 != word; word &= word - 1) {
+                    aFn(w * WORD_BITS + detail::countTrailingZeros(word));
+                }
+            }
+        }
+
+        /**
+         * @brief      Returns the raw word of the mask
+         *
+         * @param      aIdx    Index of the word
+         */
+        constexpr uint64_t word(size_t aIdx) const noexcept {
+            return m_words[aIdx];
+        }
+
+        constexpr bool operator==(field_mask const & aOther) const noexcept {
+            for (size_t w { 0 }; w < WORDS; ++w) {
+                if (m_words[w] != aOther.m_words[w]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        constexpr bool operator!=(field_mask const & aOther) const noexcept {
+            return !(*this == aOther);
+        }
+    private:
+        std::array<uint64_t, WORDS> m_words { };
+    };
+
+    /**
+     * @brief      The selection list compiled from the mask: the indexes of
+     *             the selected invokers in the ascending order. Built once and
+     *             reused, so the invoke walks through the selected invokers
+     *             only, without scanning the mask words
+     *
+     * @tparam     N    Number of the invokers
+     */
+    template<size_t N>
+    struct field_selection {
+    public:
+        using index_t = std::conditional_t<(N <= 0xffffu), uint16_t, uint32_t>;
+
+        /**
+         * @brief      Compiles the selection list
+         *
+         * @param      aMask    Mask of the selected invokers
+         */
+        explicit constexpr field_selection(field_mask<N> const & aMask) noexcept {
+            aMask.forEach([this](size_t aIdx) {
+                m_indexes[m_size++] = static_cast<index_t>(aIdx);
+            });
+        }
+
+        /**
+         * @brief      Returns number of the selected invokers
+         */
+        constexpr size_t size() const noexcept {
+            return m_size;
+        }
+
+        constexpr index_t const * begin() const noexcept {
+            return m_indexes.data();
+        }
+
+        constexpr index_t const * end() const noexcept {
+            return m_indexes.data() + m_size;
+        }
+    private:
+        std::array<index_t, N>   m_indexes { };
+        size_t                   m_size    { 0 };
+    };
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__FIELD_MASK__H */
@@ -0,0 +1,346 @@
+/**
+ * @file      flat_acceptor.h
+ *
+ * @brief     Contains the acceptor, which writes the flat snapshots with the
+ *            offset table of the tags, and the view, which reads any value of
+ *            the flat snapshot in place
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__FLAT_ACCEPTOR__H
+#define INCLUDE__FLAT_ACCEPTOR__H
+
+/* library parts */
+#include <tag_string.h>
+#include <binary_layout.h>
+#include <object_schema.h>
+
+/* STL */
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      The acceptor, which writes the whole snapshot as the single
+     *             flat snapshot, described by detail::flat_layout: the header
+     *             with the offset table of the tags, then the aligned values.
+     *             The offsets of the tags and the values are taken from the
+     *             schema, so the reader gets any value without parsing
+     *
+     * @note       The snapshot is written between begin() and end(), begin()
+     *             zeroes the whole snapshot and writes the header, so the
+     *             tags, which are not invoked (e.g. masked), read as zeroes.
+     *             The tags, which are not in the schema, or which results
+     *             don't match the schema, are skipped. When the snapshot
+     *             doesn't fit the buffer, the acceptor is marked as
+     *             overflowed, so the buffer always contains whole snapshots.
+     *             The schema shall outlive the snapshot. The acceptor never
+     *             allocates
+     */
+    class flat_acceptor {
+    public:
+        /**
+         * @brief      Creates the flat acceptor
+         *
+         * @param      aBuffer      The output buffer
+         * @param      aCapacity    Size of the output buffer
+         */
+        flat_acceptor(void * aBuffer, size_t aCapacity) noexcept
+            : m_begin { static_cast<unsigned char *>(aBuffer) }
+            , m_end   { m_begin + aCapacity                   }
+            , m_pos   { m_begin                               }
+        {}
+
+        /**
+         * @brief      Starts the snapshot, writes the header and the offset
+         *             table
+         *
+         * @param      aSchema    Schema of the invoke
+         *
+         * @return     false, if the snapshot doesn't fit the buffer, or the
+         *             schema has the leaves without the binary layout
+         */
+        template<size_t N>
+        bool begin(object_schema<N> const & aSchema) noexcept {
+            m_entries = nullptr;
+            m_count   = 0;
+            if (m_overflow || !aSchema.fixed || aSchema.flatSize > size_t(m_end - m_pos)) {
+                m_overflow = true;
+                return false;
+            }
+
+            unsigned char * const snapshot { m_pos };
+            std::memset(snapshot, 0, aSchema.flatSize);
+            detail::writeLittleEndian(snapshot, aSchema.fingerprint);
+            detail::writeLittleEndian(snapshot + sizeof(uint64_t), static_cast<uint32_t>(N));
+            detail::writeLittleEndian(snapshot + sizeof(uint64_t) + sizeof(uint32_t), static_cast<uint32_t>(aSchema.flatSize));
+            for (size_t i { 0 }; i < N; ++i) {
+                detail::writeLittleEndian(snapshot + detail::flat_layout::HEADER + sizeof(uint32_t) * i,
+                                          static_cast<uint32_t>(aSchema.entries[i].flatOffset));
+            }
+
+            m_entries = aSchema.entries.data();
+            m_count   = N;
+            m_next    = 0;
+            m_size    = aSchema.flatSize;
+            return true;
+        }
+
+        /**
+         * @brief      Writes the result of the tag
+         *
+         * @param      aTag      Associated tag
+         * @param      aTuple    The result of the methods chain
+         */
+        template<typename ... T>
+        void operator()(char const * aTag, std::tuple<T...> const & aTuple) noexcept {
+            this->write(tagId(aTag), aTuple);
+        }
+
+        /**
+         * @brief      Same as above, for the compile-time tag
+         *
+         * @param      <pos>     The compile-time tag
+         * @param      aTuple    The result of the methods chain
+         */
+        template<char ... cs, typename ... T>
+        void operator()(tag_string<cs...>, std::tuple<T...> const & aTuple) noexcept {
+            this->write(tag_string<cs...>::id, aTuple);
+        }
+
+        /**
+         * @brief      Finishes the snapshot
+         *
+         * @return     false, if the snapshot wasn't started
+         */
+        bool end() noexcept {
+            if (nullptr == m_entries) {
+                return false;
+            }
+            m_pos    += m_size;
+            m_entries = nullptr;
+            m_count   = 0;
+            return true;
+        }
+
+        /**
+         * @brief      Returns the beginning of the written data
+         */
+        unsigned char const * data() const noexcept {
+            return m_begin;
+        }
+
+        /**
+         * @brief      Returns number of the written bytes
+         */
+        size_t size() const noexcept {
+            return static_cast<size_t>(m_pos - m_begin);
+        }
+
+        /**
+         * @brief      Returns true, if any snapshot didn't fit the buffer
+         */
+        bool overflow() const noexcept {
+            return m_overflow;
+        }
+
+        /**
+         * @brief      Starts writing from the beginning of the buffer
+         */
+        void reset() noexcept {
+            m_pos      = m_begin;
+            m_entries  = nullptr;
+            m_count    = 0;
+            m_overflow = false;
+        }
+    private:
+        /**
+         * @brief      Writes the values of the tuple at the flat offsets
+         *
+         * @param      aOut      Beginning of the tag
+         * @param      aTuple    The result of the methods chain
+         */
+        template<typename ... T, size_t ... Idx>
+        static void writeFlat(unsigned char * aOut, std::tuple<T...> const & aTuple, std::index_sequence<Idx...>) noexcept {
+            using fields_t = detail::leaf_fields<std::tuple<T...>>;
+
+            (detail::writeLittleEndian(aOut + fields_t::FIELDS[Idx].flatOffset, std::get<Idx>(aTuple)), ...);
+        }
+
+        /**
+         * @brief      Writes the result of the tag at it's offset
+         *
+         * @param      aTagId    Id of the tag
+         * @param      aTuple    The result of the methods chain
+         */
+        template<typename ... T>
+        void write(uint64_t aTagId, std::tuple<T...> const & aTuple) noexcept {
+            static_assert((detail::binary_traits<std::decay_t<T>>::SUPPORTED && ...),
+                          "flat_acceptor supports only arithmetic and enum values");
+
+            using fields_t = detail::leaf_fields<std::tuple<T...>>;
+
+            size_t const index { detail::nextEntry(m_entries, m_count, m_next, aTagId) };
+            if (index == m_count) {
+                return;
+            }
+
+            auto const & entry { m_entries[index] };
+            if (entry.fieldsCount != sizeof...(T) || entry.flatSize != fields_t::FLAT_SIZE) {
+                return;
+            }
+
+            writeFlat(m_pos + entry.flatOffset, aTuple, std::index_sequence_for<T...>{});
+        }
+
+        unsigned char *         m_begin;
+        unsigned char *         m_end;
+        unsigned char *         m_pos;
+        schema_entry const *    m_entries  { nullptr };
+        size_t                  m_count    { 0       };
+        size_t                  m_next     { 0       };
+        size_t                  m_size     { 0       };
+        bool                    m_overflow { false   };
+    };
+
+    /**
+     * @brief      The view of the flat snapshot, e.g. in the memory-mapped
+     *             file. The header is validated once, then any tag and any
+     *             value is reached in O(1), without parsing and copying of
+     *             the snapshot
+     *
+     * @note       The view doesn't own the data, the data and the schema
+     *             shall outlive the view
+     */
+    class flat_view {
+    public:
+        /**
+         * @brief      Creates the view, validates the header and the offset
+         *             table against the schema
+         *
+         * @param      aData      Beginning of the snapshot
+         * @param      aSize      Size of the available data
+         * @param      aSchema    Schema of the invoke
+         */
+        template<size_t N>
+        flat_view(void const * aData, size_t aSize, object_schema<N> const & aSchema) noexcept
+            : m_data    { static_cast<unsigned char const *>(aData) }
+            , m_entries { aSchema.entries.data()                    }
+            , m_count   { N                                         }
+        {
+            if (aSize < detail::flat_layout::dataOffset(N) || !aSchema.fixed
+             || detail::readLittleEndian<uint64_t>(m_data) != aSchema.fingerprint
+             || detail::readLittleEndian<uint32_t>(m_data + sizeof(uint64_t)) != N) {
+                return;
+            }
+
+            size_t const size { detail::readLittleEndian<uint32_t>(m_data + sizeof(uint64_t) + sizeof(uint32_t)) };
+            if (size != aSchema.flatSize || size > aSize) {
+                return;
+            }
+
+            for (size_t i { 0 }; i < N; ++i) {
+                if (this->offset(i) != aSchema.entries[i].flatOffset) {
+                    return;
+                }
+            }
+            m_size = size;
+        }
+
+        /**
+         * @brief      Returns true, if the snapshot matches the schema
+         */
+        bool valid() const noexcept {
+            return 0 != m_size;
+        }
+
+        /**
+         * @brief      Returns size of the snapshot, i.e. the offset of the
+         *             next one, zero for the invalid snapshot
+         */
+        size_t size() const noexcept {
+            return m_size;
+        }
+
+        /**
+         * @brief      Returns the beginning of the tag, or nullptr
+         *
+         * @param      aIndex    Index of the tag in the schema
+         */
+        unsigned char const * tag(size_t aIndex) const noexcept {
+            if (!this->valid() || aIndex >= m_count) {
+                return nullptr;
+            }
+            return m_data + m_entries[aIndex].flatOffset;
+        }
+
+        /**
+         * @brief      Reads the value in place
+         *
+         * @tparam     T         Type of the value, shall match the schema
+         *
+         * @param      aIndex    Index of the tag in the schema
+         * @param      aField    Index of the value in the result of the tag
+         * @param      aValue    The value
+         *
+         * @return     false, if there is no such value or it's type doesn't
+         *             match the schema
+         */
+        template<typename T>
+        bool get(size_t aIndex, size_t aField, T & aValue) const noexcept {
+            unsigned char const * const tag { this->tag(aIndex) };
+            if (nullptr == tag || aField >= m_entries[aIndex].fieldsCount) {
+                return false;
+            }
+
+            auto const & field { m_entries[aIndex].fields[aField] };
+            if (field.kind != detail::leafKind<T>() || field.size != detail::leafSize<T>()) {
+                return false;
+            }
+
+            aValue = detail::readLittleEndian<T>(tag + field.flatOffset);
+            return true;
+        }
+    private:
+        /**
+         * @brief      Returns offset of the tag from the offset table
+         *
+         * @param      aIndex    Index of the tag
+         */
+        size_t offset(size_t aIndex) const noexcept {
+            return detail::readLittleEndian<uint32_t>(m_data + detail::flat_layout::HEADER + sizeof(uint32_t) * aIndex);
+        }
+
+        unsigned char const *   m_data;
+        schema_entry const *    m_entries;
+        size_t                  m_count;
+        size_t                  m_size { 0 };
+    };
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__FLAT_ACCEPTOR__H */
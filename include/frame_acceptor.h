@@ -0,0 +1,201 @@
+/**
+ * @file      frame_acceptor.h
+ *
+ * @brief     Contains the acceptor, which writes the tag-less fixed-layout
+ *            frames described by the object schema
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__FRAME_ACCEPTOR__H
+#define INCLUDE__FRAME_ACCEPTOR__H
+
+/* library parts */
+#include <tag_string.h>
+#include <binary_layout.h>
+#include <object_schema.h>
+
+/* STL */
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      The acceptor, which writes the whole snapshot as the single
+     *             frame: `[u64 schema fingerprint][results of all the tags]`.
+     *             The tags are not written, the reader finds every result by
+     *             the offset from the schema with the same fingerprint
+     *
+     * @note       The results shall come in the registration order, and all
+     *             of them, i.e. from the plain invoke of the object_invoke or
+     *             the inline_object_invoke. The frame is written between
+     *             begin() and end(), end() drops the frame, which size doesn't
+     *             match the schema. When the frame doesn't fit the buffer, the
+     *             acceptor is marked as overflowed, so the buffer always
+     *             contains whole frames. The acceptor never allocates
+     */
+    class frame_acceptor {
+    public:
+        /**
+         * @brief      Creates the frame acceptor
+         *
+         * @param      aBuffer      The output buffer
+         * @param      aCapacity    Size of the output buffer
+         */
+        frame_acceptor(void * aBuffer, size_t aCapacity) noexcept
+            : m_begin { static_cast<unsigned char *>(aBuffer) }
+            , m_end   { m_begin + aCapacity                   }
+            , m_pos   { m_begin                               }
+            , m_frame { m_begin                               }
+            , m_limit { m_begin                               }
+        {}
+
+        /**
+         * @brief      Starts the frame, writes the fingerprint
+         *
+         * @param      aSchema    Schema of the invoke
+         *
+         * @return     false, if the frame doesn't fit the buffer, or the
+         *             schema has the leaves without the binary layout
+         */
+        template<size_t N>
+        bool begin(object_schema<N> const & aSchema) noexcept {
+            unsigned char * const frame { m_pos };
+            m_frame = frame;
+            if (m_overflow || !aSchema.fixed || aSchema.frameSize() > size_t(m_end - frame)) {
+                m_overflow = true;
+                m_limit    = frame;
+                return false;
+            }
+
+            detail::writeLittleEndian(frame, aSchema.fingerprint);
+            m_limit   = frame + aSchema.frameSize();
+            m_dropped = false;
+            m_pos     = frame + sizeof(uint64_t);
+            return true;
+        }
+
+        /**
+         * @brief      Writes the result of the tag
+         *
+         * @param      aTuple    The result of the methods chain
+         */
+        template<typename ... T>
+        void operator()(char const *, std::tuple<T...> const & aTuple) noexcept {
+            this->write(aTuple);
+        }
+
+        /**
+         * @brief      Same as above, for the compile-time tag
+         *
+         * @param      aTuple    The result of the methods chain
+         */
+        template<char ... cs, typename ... T>
+        void operator()(tag_string<cs...>, std::tuple<T...> const & aTuple) noexcept {
+            this->write(aTuple);
+        }
+
+        /**
+         * @brief      Finishes the frame
+         *
+         * @return     false, if the frame is dropped: it's incomplete, or
+         *             bigger than the schema says
+         */
+        bool end() noexcept {
+            if (m_dropped || m_pos != m_limit || m_pos == m_frame) {
+                m_pos   = m_frame;
+                m_limit = m_frame;
+                return false;
+            }
+            m_limit = m_pos;
+            return true;
+        }
+
+        /**
+         * @brief      Returns the beginning of the written data
+         */
+        unsigned char const * data() const noexcept {
+            return m_begin;
+        }
+
+        /**
+         * @brief      Returns number of the written bytes
+         */
+        size_t size() const noexcept {
+            return static_cast<size_t>(m_pos - m_begin);
+        }
+
+        /**
+         * @brief      Returns true, if any frame didn't fit the buffer
+         */
+        bool overflow() const noexcept {
+            return m_overflow;
+        }
+
+        /**
+         * @brief      Starts writing from the beginning of the buffer
+         */
+        void reset() noexcept {
+            m_pos      = m_begin;
+            m_frame    = m_begin;
+            m_limit    = m_begin;
+            m_overflow = false;
+        }
+    private:
+        /**
+         * @brief      Writes the tuple, the results beyond the frame size are
+         *             dropped, end() drops the whole frame then
+         *
+         * @param      aTuple    The result of the methods chain
+         */
+        template<typename ... T>
+        void write(std::tuple<T...> const & aTuple) noexcept {
+            static_assert((detail::binary_traits<std::decay_t<T>>::SUPPORTED && ...),
+                          "frame_acceptor supports only arithmetic and enum values");
+
+            constexpr size_t SIZE { binary_size_v<std::tuple<T...>> };
+
+            if (SIZE > size_t(m_limit - m_pos)) {
+                m_limit   = m_pos;
+                m_dropped = true;
+                return;
+            }
+
+            detail::writeTuple(m_pos, aTuple, std::index_sequence_for<T...>{});
+            m_pos += SIZE;
+        }
+
+        unsigned char *  m_begin;
+        unsigned char *  m_end;
+        unsigned char *  m_pos;
+        unsigned char *  m_frame;
+        unsigned char *  m_limit;
+        bool             m_overflow { false };
+        bool             m_dropped  { false };
+    };
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__FRAME_ACCEPTOR__H */
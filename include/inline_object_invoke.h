@@ -0,0 +1,127 @@
+/**
+ * @file      inline_object_invoke.h
+ *
+ * @brief     Contains the object invoke flavor, which keeps all the methods
+ *            chains in the type, so the whole invoke is unrolled in compile
+ *            time and has no indirect calls
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__INLINE_OBJECT_INVOKE__H
+#define INCLUDE__INLINE_OBJECT_INVOKE__H
+
+/* library parts */
+#include <object_invoke.h>
+#include <metaprogramming_base.h>
+#include <object_schema.h>
+
+/* STL */
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      The object invoke, which holds every delayed invoke in a
+     *             heterogeneous tuple instead of array of invoker pointers.
+     *             All the chains are expanded via folding expression, so the
+     *             compiler is able to inline and optimize them all together
+     *
+     * @tparam     TResultAcceptor    Callable object, which invoked with the
+     *                                tag and the result of the function
+     * @tparam     TForwarders        Types of the delayed invoke forwarders
+     */
+    template<typename TResultAcceptor, typename ... TForwarders>
+    struct inline_object_invoke {
+    public:
+        using object_t   = detail::invokers_class_t<TForwarders...>;
+        using acceptor_t = TResultAcceptor;
+        using invokers_t = flat_tuple<TForwarders...>;
+
+        static constexpr size_t INVOKERS_COUNT { sizeof...(TForwarders) };
+
+        /**
+         * @brief      Creates the inline object invoke object
+         *
+         * @param      aInvokers    The delayed invoke forwarders
+         */
+        explicit constexpr inline_object_invoke(acceptor<acceptor_t>, TForwarders const & ... aInvokers)
+            : m_invokers { aInvokers... }
+        {}
+
+        /**
+         * @brief      Invokes all the registered invokers and passes every
+         *             result into the acceptor
+         */
+        constexpr void operator()(object_t & aObj, acceptor_t & aAcceptor) const {
+            this->invokeImpl(std::index_sequence_for<TForwarders...>{}, aObj, aAcceptor);
+        }
+
+        /**
+         * @brief      Returns the registered delayed invoke forwarders
+         */
+        constexpr invokers_t const & invokers() const noexcept {
+            return m_invokers;
+        }
+
+        /**
+         * @brief      Returns the schema of the invoke (see object_schema),
+         *             it's the constant expression for the constexpr invoke
+         */
+        constexpr object_schema<INVOKERS_COUNT> schema() const noexcept {
+            return this->schemaImpl(std::index_sequence_for<TForwarders...>{});
+        }
+    private:
+        /**
+         * @brief      Makes the schema from the tags of all the invokers
+         *
+         * @tparam     Idx    Indexes of the invokers
+         */
+        template<size_t ... Idx>
+        constexpr object_schema<INVOKERS_COUNT> schemaImpl(std::index_sequence<Idx...>) const noexcept {
+            return detail::makeSchema<INVOKERS_COUNT>({ get<Idx>(m_invokers).tag()... },
+                                                      { &detail::leaf_fields<typename TForwarders::leaves_t>::LAYOUT... });
+        }
+
+        /**
+         * @brief      The implementation of the invoke, expands all the
+         *             invokers in the registration order
+         *
+         * @tparam     Idx    Indexes of the invokers
+         */
+        template<size_t ... Idx>
+        constexpr void invokeImpl(std::index_sequence<Idx...>, object_t & aObj, acceptor_t & aAcceptor) const {
+            (get<Idx>(m_invokers)(aObj, aAcceptor), ...);
+        }
+
+        invokers_t   m_invokers;
+    };
+
+    /* class deduction guides */
+    template<typename TResultAcceptor, typename ... T>
+    explicit inline_object_invoke(acceptor<TResultAcceptor>, T ...) -> inline_object_invoke<TResultAcceptor, T...>;
+
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__INLINE_OBJECT_INVOKE__H */
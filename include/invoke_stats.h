@@ -0,0 +1,170 @@
+/**
+ * @file      invoke_stats.h
+ *
+ * @brief     Contains the per-tag instrumentation of the invokes: invocation
+ *            count, cumulative time and latency histogram, kept in the
+ *            fixed-size cache-aligned block
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__INVOKE_STATS__H
+#define INCLUDE__INVOKE_STATS__H
+
+/* library parts */
+#include <field_mask.h>
+
+/* STL */
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <atomic>
+#include <chrono>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      detail component namespace
+     */
+    namespace detail {
+        /**
+         * @brief      Returns the current time in ticks: the time stamp counter
+         *             cycles on x86, nanoseconds of the steady clock otherwise
+         */
+        inline uint64_t readTicks() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+            return __rdtsc();
+#else
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+        }
+
+        /**
+         * @brief      Returns the histogram bucket of the duration: bucket `i`
+         *             holds the durations in [2^(i-1), 2^i) ticks, the last
+         *             one holds all the longer ones
+         *
+         * @param      aTicks      The duration
+         * @param      aBuckets    Number of the buckets
+         */
+        constexpr inline size_t histogramBucket(uint64_t aTicks, size_t aBuckets) noexcept {
+            size_t const width { 0 == aTicks ? 0 : 64 - countLeadingZeros(aTicks) };
+            return width < aBuckets ? width : aBuckets - 1;
+        }
+    } /* end of namespace detail */
+
+    /**
+     * @brief      The plain copy of the tag statistics
+     */
+    struct tag_stats_snapshot {
+        static constexpr size_t BUCKETS { 32 };
+
+        uint64_t                          count     { 0 };
+        uint64_t                          ticks     { 0 };
+        std::array<uint64_t, BUCKETS>     histogram { };
+    };
+
+    /**
+     * @brief      Statistics of the single tag, takes own cache lines, so
+     *             the neighbour tags don't share them
+     *
+     * @note       There shall be the single writer (the thread doing the
+     *             invokes), so the counters are updated without the locked
+     *             instructions. Any thread may read them at any time, the
+     *             counters are read one by one, so the snapshot may be
+     *             slightly inconsistent
+     */
+    struct alignas(64) tag_stats {
+        static constexpr size_t BUCKETS { tag_stats_snapshot::BUCKETS };
+
+        std::atomic<uint64_t>                          count     { 0 };
+        std::atomic<uint64_t>                          ticks     { 0 };
+        std::array<std::atomic<uint64_t>, BUCKETS>     histogram { };
+
+        /**
+         * @brief      Records the single invoke
+         *
+         * @param      aTicks    Duration of the invoke
+         */
+        void record(uint64_t aTicks) noexcept {
+            increment(count, 1);
+            increment(ticks, aTicks);
+            increment(histogram[detail::histogramBucket(aTicks, BUCKETS)], 1);
+        }
+
+        /**
+         * @brief      Returns the copy of the counters, safe to call from any
+         *             thread
+         */
+        tag_stats_snapshot snapshot() const noexcept {
+            tag_stats_snapshot result { };
+            result.count = count.load(std::memory_order_relaxed);
+            result.ticks = ticks.load(std::memory_order_relaxed);
+            for (size_t i { 0 }; i < BUCKETS; ++i) {
+                result.histogram[i] = histogram[i].load(std::memory_order_relaxed);
+            }
+            return result;
+        }
+
+        /**
+         * @brief      Clears the counters, shall be called by the writer
+         */
+        void reset() noexcept {
+            count.store(0, std::memory_order_relaxed);
+            ticks.store(0, std::memory_order_relaxed);
+            for (auto & bucket: histogram) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+    private:
+        static void increment(std::atomic<uint64_t> & aCounter, uint64_t aValue) noexcept {
+            aCounter.store(aCounter.load(std::memory_order_relaxed) + aValue, std::memory_order_relaxed);
+        }
+    };
+
+    /**
+     * @brief      The statistics of all the invokers of the object invoke,
+     *             indexed in the registration order
+     *
+     * @tparam     N    Number of the invokers
+     */
+    template<size_t N>
+    struct invoke_stats {
+        std::array<tag_stats, N> tags { };
+
+        /**
+         * @brief      Clears all the counters
+         */
+        void reset() noexcept {
+            for (auto & tag: tags) {
+                tag.reset();
+            }
+        }
+    };
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__INVOKE_STATS__H */
@@ -0,0 +1,657 @@
+/**
+ * @file      json_acceptor.h
+ *
+ * @brief     Contains the acceptor, which writes the snapshots as JSON into
+ *            the growable contiguous buffer, without streams and locales
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__JSON_ACCEPTOR__H
+#define INCLUDE__JSON_ACCEPTOR__H
+
+/* library parts */
+#include <tag_string.h>
+#include <object_schema.h>
+
+/* STL */
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      detail component namespace
+     */
+    namespace detail {
+        /**
+         * @brief      Returns true, if the character shall be escaped in the
+         *             JSON string: the quote, the backslash and the control
+         *             characters
+         *
+         * @param      aChar    The character
+         */
+        constexpr inline bool jsonEscaped(char aChar) noexcept {
+            return '"' == aChar || '\\' == aChar || static_cast<unsigned char>(aChar) < 0x20u;
+        }
+
+        /**
+         * @brief      Returns size of the escaped character
+         *
+         * @param      aChar    The character
+         */
+        constexpr inline size_t jsonEscapedSize(char aChar) noexcept {
+            switch (aChar) {
+            case '"': case '\\': case '\b': case '\f': case '\n': case '\r': case '\t':
+                return 2;
+            default:
+                return jsonEscaped(aChar) ? 6 : 1;
+            }
+        }
+
+        /**
+         * @brief      Writes the escaped character
+         *
+         * @param      aOut     Output position
+         * @param      aChar    The character
+         *
+         * @return     Position after the character
+         */
+        constexpr inline char * jsonEscape(char * aOut, char aChar) noexcept {
+            char const * const HEX { "0123456789abcdef" };
+            switch (aChar) {
+            case '"':  *aOut++ = '\\'; *aOut++ = '"';  break;
+            case '\\': *aOut++ = '\\'; *aOut++ = '\\'; break;
+            case '\b': *aOut++ = '\\'; *aOut++ = 'b';  break;
+            case '\f': *aOut++ = '\\'; *aOut++ = 'f';  break;
+            case '\n': *aOut++ = '\\'; *aOut++ = 'n';  break;
+            case '\r': *aOut++ = '\\'; *aOut++ = 'r';  break;
+            case '\t': *aOut++ = '\\'; *aOut++ = 't';  break;
+            default:
+                if (jsonEscaped(aChar)) {
+                    *aOut++ = '\\'; *aOut++ = 'u'; *aOut++ = '0'; *aOut++ = '0';
+                    *aOut++ = HEX[static_cast<unsigned char>(aChar) >> 4];
+                    *aOut++ = HEX[static_cast<unsigned char>(aChar) & 0xfu];
+                } else {
+                    *aOut++ = aChar;
+                }
+                break;
+            }
+            return aOut;
+        }
+
+        /**
+         * @brief      Returns length of the prefix, which has no characters
+         *             to escape. SSE2 checks 16 characters at once
+         *
+         * @param      aStr     The string
+         * @param      aSize    Length of the string
+         */
+        inline size_t jsonPlainPrefix(char const * aStr, size_t aSize) noexcept {
+            size_t i { 0 };
+#if defined(__SSE2__)
+            __m128i const quote     { _mm_set1_epi8('"')  };
+            __m128i const backslash { _mm_set1_epi8('\\') };
+            __m128i const control   { _mm_set1_epi8(0x1f) };
+            for (; i + 16 <= aSize; i += 16) {
+                __m128i const chars   { _mm_loadu_si128(reinterpret_cast<__m128i const *>(aStr + i)) };
+                __m128i const escaped { _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chars, quote), _mm_cmpeq_epi8(chars, backslash)),
+                                                     _mm_cmpeq_epi8(_mm_subs_epu8(chars, control), _mm_setzero_si128())) };
+                int const mask { _mm_movemask_epi8(escaped) };
+                if (0 != mask) {
+                    return i + static_cast<size_t>(__builtin_ctz(static_cast<unsigned>(mask)));
+                }
+            }
+#endif
+            for (; i < aSize && !jsonEscaped(aStr[i]); ++i) {}
+            return i;
+        }
+
+        /**
+         * @brief      Writes the quoted escaped string, the output shall have
+         *             `6 * aSize + 2` characters
+         *
+         * @param      aOut     Output position
+         * @param      aStr     The string
+         * @param      aSize    Length of the string
+         *
+         * @return     Position after the string
+         */
+        inline char * writeJsonString(char * aOut, char const * aStr, size_t aSize) noexcept {
+            *aOut++ = '"';
+            while (0 != aSize) {
+                size_t const plain { jsonPlainPrefix(aStr, aSize) };
+                std::memcpy(aOut, aStr, plain);
+                aOut  += plain;
+                aStr  += plain;
+                aSize -= plain;
+                if (0 != aSize) {
+                    aOut = jsonEscape(aOut, *aStr++);
+                    --aSize;
+                }
+            }
+            *aOut++ = '"';
+            return aOut;
+        }
+
+        /**
+         * @brief      The JSON key of the compile-time tag, `"name":`,
+         *             rendered in compile time
+         *
+         * @tparam     cs    Characters of the tag name
+         */
+        template<char ... cs>
+        struct json_key {
+            static constexpr size_t SIZE { 3 + (size_t{ 0 } + ... + jsonEscapedSize(cs)) };
+
+            static constexpr std::array<char, SIZE> make() noexcept {
+                std::array<char, SIZE> key { };
+                char * out { key.data() };
+                *out++ = '"';
+                ((out = jsonEscape(out, cs)), ...);
+                *out++ = '"';
+                *out++ = ':';
+                return key;
+            }
+
+            static constexpr std::array<char, SIZE> VALUE { make() };
+        };
+
+    /** @{ */
+    /* json_traits meta-function, describes the JSON value of the type */
+        /**
+         * @brief      Initial definition, the type has no JSON value
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T, typename = void>
+        struct json_traits {
+            static constexpr bool SUPPORTED { false };
+        };
+
+        /**
+         * @brief      Overload for bool
+         */
+        template<>
+        struct json_traits<bool> {
+            static constexpr bool   SUPPORTED { true };
+            static constexpr size_t MAX_SIZE  { 5    };
+
+            static char * write(char * aOut, bool aValue) noexcept {
+                std::memcpy(aOut, aValue ? "true" : "false", aValue ? 4 : 5);
+                return aOut + (aValue ? 4 : 5);
+            }
+        };
+
+        /**
+         * @brief      Overload for char, it's the single character string
+         */
+        template<>
+        struct json_traits<char> {
+            static constexpr bool   SUPPORTED { true };
+            static constexpr size_t MAX_SIZE  { 8    };
+
+            static char * write(char * aOut, char aValue) noexcept {
+                *aOut++ = '"';
+                aOut    = jsonEscape(aOut, aValue);
+                *aOut++ = '"';
+                return aOut;
+            }
+        };
+
+        /**
+         * @brief      Overload for the integers, the size covers the sign and
+         *             all the digits of the type, including the 128-bit
+         *             integers of the GNU extensions
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T>
+        struct json_traits<T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char>>> {
+            static constexpr bool   SUPPORTED { true };
+            static constexpr size_t MAX_SIZE  { size_t(std::numeric_limits<T>::digits10) + 3 };
+
+            static char * write(char * aOut, T aValue) noexcept {
+                auto const [end, ec] { std::to_chars(aOut, aOut + MAX_SIZE, aValue) };
+                if (std::errc{} != ec) {
+                    std::memcpy(aOut, "null", 4);
+                    return aOut + 4;
+                }
+                return end;
+            }
+        };
+
+        /**
+         * @brief      Overload for the enums, written as the underlying values
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T>
+        struct json_traits<T, std::enable_if_t<std::is_enum_v<T>>> {
+            using underlying_t = std::underlying_type_t<T>;
+
+            static constexpr bool   SUPPORTED { true };
+            static constexpr size_t MAX_SIZE  { json_traits<underlying_t>::MAX_SIZE };
+
+            static char * write(char * aOut, T aValue) noexcept {
+                return json_traits<underlying_t>::write(aOut, static_cast<underlying_t>(aValue));
+            }
+        };
+
+        /**
+         * @brief      Overload for the floating point values, the shortest
+         *             representation, which reads back to the same value. The
+         *             infinities and NaN are written as null
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T>
+        struct json_traits<T, std::enable_if_t<std::is_floating_point_v<T>>> {
+            static constexpr bool   SUPPORTED { true };
+            static constexpr size_t MAX_SIZE  { 48   };
+
+            static char * write(char * aOut, T aValue) noexcept {
+                if (!std::isfinite(aValue)) {
+                    std::memcpy(aOut, "null", 4);
+                    return aOut + 4;
+                }
+#if defined(__cpp_lib_to_chars)
+                return std::to_chars(aOut, aOut + MAX_SIZE, aValue).ptr;
+#else
+                int const size { std::snprintf(aOut, MAX_SIZE, "%.17g", static_cast<double>(aValue)) };
+                return aOut + (size > 0 ? size : 0);
+#endif
+            }
+        };
+
+        /**
+         * @brief      Overload for the strings: std::string, std::string_view
+         *             and the types convertible to them. The size of the
+         *             string is known in runtime only
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T>
+        struct json_traits<T, std::enable_if_t<std::is_convertible_v<T const &, std::string_view> && !std::is_pointer_v<T>>> {
+            static constexpr bool   SUPPORTED { true };
+            static constexpr size_t MAX_SIZE  { 0    };
+
+            static size_t size(T const & aValue) noexcept {
+                return 6 * std::string_view{ aValue }.size() + 2;
+            }
+
+            static char * write(char * aOut, T const & aValue) noexcept {
+                std::string_view const str { aValue };
+                return writeJsonString(aOut, str.data(), str.size());
+            }
+        };
+
+        /**
+         * @brief      Overload for the C strings, nullptr is written as null
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T>
+        struct json_traits<T, std::enable_if_t<std::is_same_v<T, char const *> || std::is_same_v<T, char *>>> {
+            static constexpr bool   SUPPORTED { true };
+            static constexpr size_t MAX_SIZE  { 0    };
+
+            static size_t size(T aValue) noexcept {
+                return nullptr == aValue ? 4 : 6 * std::strlen(aValue) + 2;
+            }
+
+            static char * write(char * aOut, T aValue) noexcept {
+                if (nullptr == aValue) {
+                    std::memcpy(aOut, "null", 4);
+                    return aOut + 4;
+                }
+                return writeJsonString(aOut, aValue, std::strlen(aValue));
+            }
+        };
+    /** @} */
+
+        /**
+         * @brief      Returns the maximal size of the JSON value
+         *
+         * @param      aValue    The value
+         */
+        template<typename T>
+        inline size_t jsonSize(T const & aValue) noexcept {
+            if constexpr (0 == json_traits<T>::MAX_SIZE) {
+                return json_traits<T>::size(aValue);
+            } else {
+                (void)aValue;
+                return json_traits<T>::MAX_SIZE;
+            }
+        }
+    } /* end of namespace detail */
+
+    /**
+     * @brief      The acceptor, which writes every snapshot as the JSON
+     *             object, one line per snapshot: `{"tag":value,...}`. The
+     *             single value of the tag is written as is, the several
+     *             values are written as the array, no values as null
+     *
+     * @note       The keys of the compile-time tags are rendered in compile
+     *             time. The keys of the runtime tags are rendered once, when
+     *             the acceptor is created from the schema of the invoke, the
+     *             tags, which are not in the schema, are rendered on every
+     *             call. The numbers are written by std::to_chars, the strings
+     *             are scanned for the characters to escape by 16 at once, the
+     *             plain runs are copied as is. The buffer grows on demand and
+     *             never shrinks, so there are no allocations in the steady
+     *             state
+     */
+    class json_acceptor {
+    public:
+        /**
+         * @brief      Creates the JSON acceptor, which renders the keys of
+         *             the runtime tags on every call
+         */
+        json_acceptor() = default;
+
+        /**
+         * @brief      Creates the JSON acceptor, renders the keys of all the
+         *             tags of the schema
+         *
+         * @param      aSchema    Schema of the invoke
+         */
+        template<size_t N>
+        explicit json_acceptor(object_schema<N> const & aSchema)
+            : m_keys     { new key_entry[N] }
+            , m_keysSize { N                }
+        {
+            size_t size { 0 };
+            for (auto const & entry: aSchema.entries) {
+                size += 6 * std::strlen(entry.tag) + 3;
+            }
+            m_keysData.reset(new char[size]);
+
+            char * out { m_keysData.get() };
+            for (size_t i { 0 }; i < N; ++i) {
+                char * const key { out };
+                out    = detail::writeJsonString(out, aSchema.entries[i].tag, std::strlen(aSchema.entries[i].tag));
+                *out++ = ':';
+                m_keys[i] = key_entry{ aSchema.entries[i].tag, aSchema.entries[i].id, key, static_cast<size_t>(out - key) };
+            }
+        }
+
+        /**
+         * @brief      Starts the snapshot
+         */
+        void begin() {
+            this->reserve(1);
+            m_data[m_size++] = '{';
+            m_first = true;
+            m_next  = 0;
+        }
+
+        /**
+         * @brief      Writes the result of the tag
+         *
+         * @param      aTag      Associated tag
+         * @param      aTuple    The result of the methods chain
+         */
+        template<typename ... T>
+        void operator()(char const * aTag, std::tuple<T...> const & aTuple) {
+            key_entry const * const key { this->findKey(aTag) };
+            if (nullptr != key) {
+                this->member(key->key, key->size, aTuple);
+                return;
+            }
+
+            size_t const length { std::strlen(aTag) };
+            this->reserve(6 * length + 4 + valueSize(aTuple));
+            char * out { this->separator() };
+            out    = detail::writeJsonString(out, aTag, length);
+            *out++ = ':';
+            out    = writeValue(out, aTuple);
+            m_size = static_cast<size_t>(out - m_data.get());
+        }
+
+        /**
+         * @brief      Writes the result of the compile-time tag, the key is
+         *             rendered in compile time
+         *
+         * @param      <pos>     The compile-time tag
+         * @param      aTuple    The result of the methods chain
+         */
+        template<char ... cs, typename ... T>
+        void operator()(tag_string<cs...>, std::tuple<T...> const & aTuple) {
+            using key_t = detail::json_key<cs...>;
+            this->member(key_t::VALUE.data(), key_t::SIZE, aTuple);
+        }
+
+        /**
+         * @brief      Finishes the snapshot
+         */
+        void end() {
+            this->reserve(2);
+            m_data[m_size++] = '}';
+            m_data[m_size++] = '\n';
+        }
+
+        /**
+         * @brief      Returns the beginning of the written data
+         */
+        char const * data() const noexcept {
+            return m_data.get();
+        }
+
+        /**
+         * @brief      Returns number of the written characters
+         */
+        size_t size() const noexcept {
+            return m_size;
+        }
+
+        /**
+         * @brief      Returns the written data
+         */
+        std::string_view view() const noexcept {
+            return std::string_view{ m_data.get(), m_size };
+        }
+
+        /**
+         * @brief      Starts writing from the beginning of the buffer
+         */
+        void reset() noexcept {
+            m_size = 0;
+        }
+    private:
+        /**
+         * @brief      The rendered key of the runtime tag
+         */
+        struct key_entry {
+            char const *   tag;
+            uint64_t       id;
+            char const *   key;
+            size_t         size;
+        };
+
+        /**
+         * @brief      Returns the rendered key of the tag, or nullptr. The
+         *             tags are expected in the registration order, then the
+         *             key is found by the single comparison of the pointers
+         *
+         * @param      aTag    The tag
+         */
+        key_entry const * findKey(char const * aTag) noexcept {
+            if (m_next < m_keysSize && m_keys[m_next].tag == aTag) {
+                return &m_keys[m_next++];
+            }
+
+            uint64_t const id { tagId(aTag) };
+            for (size_t i { 0 }; i < m_keysSize; ++i) {
+                if (m_keys[i].id == id) {
+                    m_next = i + 1;
+                    return &m_keys[i];
+                }
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief      Makes sure the buffer fits the requested number of the
+         *             characters more
+         *
+         * @param      aSize    Number of the characters
+         */
+        void reserve(size_t aSize) {
+            if (aSize > m_capacity - m_size) {
+                this->grow(aSize);
+            }
+        }
+
+        /**
+         * @brief      Grows the buffer, so it fits the requested number of the
+         *             characters more, the rare path of reserve()
+         *
+         * @param      aSize    Number of the characters
+         */
+        void grow(size_t aSize) {
+            size_t capacity { m_capacity < 256 ? 256 : m_capacity };
+            while (aSize > capacity - m_size) {
+                capacity *= 2;
+            }
+            std::unique_ptr<char[]> data { new char[capacity] };
+            if (0 != m_size) {
+                std::memcpy(data.get(), m_data.get(), m_size);
+            }
+            m_data     = std::move(data);
+            m_capacity = capacity;
+        }
+
+        /**
+         * @brief      Writes the separator of the members, the buffer shall
+         *             have the room for it
+         *
+         * @return     Position after the separator
+         */
+        char * separator() noexcept {
+            char * out { m_data.get() + m_size };
+            if (!m_first) {
+                *out++ = ',';
+            }
+            m_first = false;
+            return out;
+        }
+
+        /**
+         * @brief      Writes the separator, the rendered key and the value
+         *
+         * @param      aKey      The rendered key
+         * @param      aSize     Size of the rendered key
+         * @param      aTuple    The result of the methods chain
+         */
+        template<typename ... T>
+        void member(char const * aKey, size_t aSize, std::tuple<T...> const & aTuple) {
+            this->reserve(aSize + 1 + valueSize(aTuple));
+            char * out { this->separator() };
+            std::memcpy(out, aKey, aSize);
+            out    = writeValue(out + aSize, aTuple);
+            m_size = static_cast<size_t>(out - m_data.get());
+        }
+
+        /**
+         * @brief      Returns the maximal size of the values of the tuple,
+         *             including the separators
+         */
+        template<typename Tuple, size_t ... Idx>
+        static size_t valuesSize(Tuple const & aTuple, std::index_sequence<Idx...>) noexcept {
+            return (size_t{ 0 } + ... + (1 + detail::jsonSize(std::get<Idx>(aTuple))));
+        }
+
+        /**
+         * @brief      Writes the values of the tuple, separated by commas
+         */
+        template<typename Tuple, size_t ... Idx>
+        static char * writeValues(char * aOut, Tuple const & aTuple, std::index_sequence<Idx...>) noexcept {
+            ((aOut = 0 == Idx ? aOut : (*aOut = ',', aOut + 1),
+              aOut = detail::json_traits<std::decay_t<std::tuple_element_t<Idx, Tuple>>>::write(aOut, std::get<Idx>(aTuple))), ...);
+            return aOut;
+        }
+
+        /**
+         * @brief      Returns the maximal size of the value of the member
+         *
+         * @param      aTuple    The result of the methods chain
+         */
+        template<typename ... T>
+        static size_t valueSize(std::tuple<T...> const & aTuple) noexcept {
+            static_assert((detail::json_traits<std::decay_t<T>>::SUPPORTED && ...),
+                          "json_acceptor supports only arithmetic, enum and string values");
+
+            return 4 + valuesSize(aTuple, std::index_sequence_for<T...>{});
+        }
+
+        /**
+         * @brief      Writes the value of the member, the buffer shall have
+         *             the room for it
+         *
+         * @param      aOut      Output position
+         * @param      aTuple    The result of the methods chain
+         *
+         * @return     Position after the value
+         */
+        template<typename ... T>
+        static char * writeValue(char * aOut, std::tuple<T...> const & aTuple) noexcept {
+            if constexpr (0 == sizeof...(T)) {
+                std::memcpy(aOut, "null", 4);
+                return aOut + 4;
+            } else if constexpr (1 == sizeof...(T)) {
+                return writeValues(aOut, aTuple, std::index_sequence_for<T...>{});
+            } else {
+                *aOut++ = '[';
+                aOut    = writeValues(aOut, aTuple, std::index_sequence_for<T...>{});
+                *aOut++ = ']';
+                return aOut;
+            }
+        }
+
+        std::unique_ptr<char[]>      m_data     { };
+        size_t                       m_size     { 0 };
+        size_t                       m_capacity { 0 };
+        std::unique_ptr<key_entry[]> m_keys     { };
+        std::unique_ptr<char[]>      m_keysData { };
+        size_t                       m_keysSize { 0 };
+        size_t                       m_next     { 0 };
+        bool                         m_first    { true };
+    };
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__JSON_ACCEPTOR__H */
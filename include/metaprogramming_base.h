@@ -26,6 +26,10 @@
 #ifndef INCLUDE__METAPROGRAMMING_BASE__H
 #define INCLUDE__METAPROGRAMMING_BASE__H
 
+/* STL */
+#include <cstddef>
+#include <utility>
+
 /**
  * @brief      mil component namespace
  */
@@ -36,7 +40,9 @@ namespace mil {
      * @tparam     vals
      */
     template<auto ... vals>
-    struct values_list {};
+    struct values_list {
+        static constexpr size_t SIZE { sizeof...(vals) };
+    };
 
     /**
      * @brief      Compile-time list of types
@@ -75,6 +81,150 @@ namespace mil {
 
 /** @} */
 
+/** @{ */
+/* last meta-function, which returns last type */
+    /**
+     * @brief      Holds the type, so the comma folding picks the last one
+     *             without the recursion
+     *
+     * @tparam     T    The type
+     */
+    template<typename T>
+    struct last_holder {
+        using type = T;
+    };
+
+    /**
+     * @brief      stl's _t standalone type
+     *
+     * @tparam     Types    types pack
+     */
+    template<typename ... Types>
+    using last_t = typename decltype((last_holder<Types>{}, ...))::type;
+
+/** @} */
+
+/** @{ */
+/* concat meta-function, which joins several types lists */
+    /**
+     * @brief      Joins two types lists, never defined, used only in the
+     *             unevaluated context
+     *
+     * @tparam     L    Types of the left list
+     * @tparam     R    Types of the right list
+     */
+    template<typename ... L, typename ... R>
+    types_list<L..., R...> operator+(types_list<L...>, types_list<R...>);
+
+    /**
+     * @brief      Joins all the passed types lists, expanded via folding
+     *             expression, so no recursive instantiations are required
+     *
+     * @tparam     Lists    types lists to join
+     */
+    template<typename ... Lists>
+    struct concat {
+        using type = decltype((types_list<>{} + ... + Lists{}));
+    };
+
+    /**
+     * @brief      stl's _t standalone type
+     *
+     * @tparam     Lists    types lists to join
+     */
+    template<typename ... Lists>
+    using concat_t = typename concat<Lists...>::type;
+/** @} */
+
+    /**
+     * @brief      detail component namespace
+     */
+    namespace detail {
+        /**
+         * @brief      The element of the flat tuple
+         *
+         * @tparam     Idx    Index of the element
+         * @tparam     T      Type of the element
+         */
+        template<size_t Idx, typename T>
+        struct flat_tuple_leaf {
+            T value;
+        };
+
+        /**
+         * @brief      Initial definition, unused
+         */
+        template<typename Seq, typename ... T>
+        struct flat_tuple_base;
+
+        /**
+         * @brief      All the elements are the direct bases, so neither the
+         *             construction nor the access is recursive
+         *
+         * @tparam     Idx    Indexes of the elements
+         * @tparam     T      Types of the elements
+         */
+        template<size_t ... Idx, typename ... T>
+        struct flat_tuple_base<std::index_sequence<Idx...>, T...> : flat_tuple_leaf<Idx, T>... {
+            explicit constexpr flat_tuple_base(T const & ... aValues)
+                : flat_tuple_leaf<Idx, T>{ aValues }...
+            {}
+        };
+
+        /**
+         * @brief      Returns type of the element, never defined, used only in
+         *             the unevaluated context
+         */
+        template<size_t Idx, typename T>
+        T leafType(flat_tuple_leaf<Idx, T> const &);
+    } /* end of namespace detail */
+
+    /**
+     * @brief      The tuple, which elements are selected by the overload
+     *             resolution instead of the recursive instantiations, so it
+     *             scales to thousands of elements. Used to keep the delayed
+     *             invoke forwarders
+     *
+     * @tparam     T    Types of the elements
+     */
+    template<typename ... T>
+    struct flat_tuple : detail::flat_tuple_base<std::index_sequence_for<T...>, T...> {
+        static constexpr size_t SIZE { sizeof...(T) };
+
+        using detail::flat_tuple_base<std::index_sequence_for<T...>, T...>::flat_tuple_base;
+    };
+
+/** @{ */
+/* get function, which returns the element of the flat tuple */
+    /**
+     * @brief      Returns the element, the tuple is converted into the element
+     *             base at the call site, so the function doesn't depend on the
+     *             whole tuple type (the per-index functions taking the tuple
+     *             make the compilation quadratic)
+     *
+     * @tparam     Idx    Index of the element
+     * @tparam     T      Type of the element, deduced
+     */
+    template<size_t Idx, typename T>
+    constexpr T const & get(detail::flat_tuple_leaf<Idx, T> const & aLeaf) noexcept {
+        return aLeaf.value;
+    }
+
+    template<size_t Idx, typename T>
+    constexpr T & get(detail::flat_tuple_leaf<Idx, T> & aLeaf) noexcept {
+        return aLeaf.value;
+    }
+/** @} */
+
+    /**
+     * @brief      Returns type of the element of the flat tuple
+     *
+     * @tparam     Idx      Index of the element
+     * @tparam     Tuple    The flat tuple
+     */
+    template<size_t Idx, typename Tuple>
+    using flat_tuple_element_t = decltype(detail::leafType<Idx>(std::declval<Tuple const &>()));
+
 } /* end of namespace mil */
 
 #endif /* end of #ifndef INCLUDE__METAPROGRAMMING_BASE__H */
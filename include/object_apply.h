@@ -0,0 +1,253 @@
+/**
+ * @file      object_apply.h
+ *
+ * @brief     Contains the reverse of the object invoke: decodes the records
+ *            written by the binary_acceptor and applies them to the object
+ *            through the setters chains
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__OBJECT_APPLY__H
+#define INCLUDE__OBJECT_APPLY__H
+
+/* library parts */
+#include <chain_apply.h>
+#include <object_invoke.h>
+#include <binary_layout.h>
+#include <object_schema.h>
+#include <tag_string.h>
+#include <metaprogramming_base.h>
+
+/* STL */
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      detail component namespace
+     */
+    namespace detail {
+        /**
+         * @brief      Supporting forwarding type, holds the accessors chain
+         *             finished with the setter, and the associated tag id
+         *
+         * @tparam     TTag   Type of the tag, `char const *` or the
+         *                    compile-time tag
+         * @tparam     fx     Accessors chain, finished with the setter
+         */
+        template<typename TTag, auto ... fx>
+        struct delayed_apply_forwarder {
+            using cl     = typename first_class<decltype(fx)...>::type;
+            using tag_t  = TTag;
+            using args_t = typename function_info<decltype(lastMethod<fx...>())>::args;
+
+            static constexpr size_t PAYLOAD { binary_size_v<args_t> };
+
+            /**
+             * @brief      Creates the forwarder
+             *
+             * @param      aTag    Tag to use
+             */
+            explicit constexpr delayed_apply_forwarder(TTag aTag)
+                : m_tagId { tagId(aTag) }
+            {}
+
+            /**
+             * @brief      Returns id of the associated tag
+             */
+            constexpr uint64_t id() const noexcept {
+                return m_tagId;
+            }
+
+            /**
+             * @brief      Decodes the setter arguments and applies them
+             *
+             * @param      aObject    Object to apply to
+             * @param      aIn        The encoded arguments
+             */
+            void operator()(cl & aObject, unsigned char const * aIn) const {
+                chainApplyEncoded<fx...>(aObject, aIn);
+            }
+        private:
+            /**
+             * @brief      Id of the associated tag
+             */
+            uint64_t m_tagId;
+        };
+    } /* end of namespace detail */
+
+    /**
+     * @brief      Creates the delayed apply (used to pass methods list into
+     *             the object_apply)
+     *
+     * @tparam     fx     Accessors chain, finished with the setter
+     *
+     * @param      tag    Associated tag
+     *
+     * @return     Delayed apply object
+     */
+    template<auto ... fx>
+    constexpr auto delayedApply(char const * tag) {
+        return detail::delayed_apply_forwarder<char const *, fx...>{ tag };
+    }
+
+    /**
+     * @brief      Same as above, but for the compile-time tag
+     *
+     * @tparam     fx     Accessors chain, finished with the setter
+     * @tparam     cs     Characters of the tag
+     *
+     * @param      tag    Associated tag
+     *
+     * @return     Delayed apply object
+     */
+    template<auto ... fx, char ... cs>
+    constexpr auto delayedApply(tag_string<cs...> tag) {
+        return detail::delayed_apply_forwarder<tag_string<cs...>, fx...>{ tag };
+    }
+
+    /**
+     * @brief      The object apply, which decodes the records written by the
+     *             binary_acceptor and applies every record to the object via
+     *             the setters chain registered with the same tag
+     *
+     * @tparam     TForwarders    Types of the delayed apply forwarders
+     */
+    template<typename ... TForwarders>
+    struct object_apply {
+    public:
+        using object_t = detail::invokers_class_t<TForwarders...>;
+
+        static constexpr size_t APPLIERS_COUNT { sizeof...(TForwarders) };
+
+        /**
+         * @brief      Creates the object apply object
+         *
+         * @param      aAppliers    The delayed apply forwarders
+         */
+        explicit constexpr object_apply(TForwarders const & ... aAppliers)
+            : m_appliers { aAppliers... }
+        {}
+
+        /**
+         * @brief      Applies all the records of the buffer to the object
+         *
+         * @param      aObj     Object to apply to
+         * @param      aData    The records
+         * @param      aSize    Size of the records
+         *
+         * @return     Number of the bytes decoded. It's less than aSize, when
+         *             the record with unknown tag or truncated record is met
+         */
+        size_t operator()(object_t & aObj, void const * aData, size_t aSize) const {
+            auto const * const begin { static_cast<unsigned char const *>(aData) };
+            auto const * const end   { begin + aSize };
+            auto const *       pos   { begin };
+
+            while (size_t(end - pos) >= sizeof(uint64_t)) {
+                auto const id      { detail::readLittleEndian<uint64_t>(pos) };
+                size_t     payload { 0 };
+
+                if (!this->applyRecord(std::index_sequence_for<TForwarders...>{}, id, aObj,
+                                       pos + sizeof(uint64_t), size_t(end - pos) - sizeof(uint64_t), payload)) {
+                    break;
+                }
+                pos += sizeof(uint64_t) + payload;
+            }
+
+            return size_t(pos - begin);
+        }
+
+        /**
+         * @brief      Applies the frame written by the frame_acceptor: every
+         *             result is found by the offset from the schema, and
+         *             applied by the applier with the same tag. The results
+         *             without the applier are skipped
+         *
+         * @param      aObj       Object to apply to
+         * @param      aData      The frame
+         * @param      aSize      Size of the data
+         * @param      aSchema    Schema of the invoke, which wrote the frame
+         *
+         * @return     Size of the frame, zero, if the frame is truncated or
+         *             has the other fingerprint
+         */
+        template<size_t N>
+        size_t operator()(object_t & aObj, void const * aData, size_t aSize, object_schema<N> const & aSchema) const {
+            auto const * const frame { static_cast<unsigned char const *>(aData) };
+            if (aSchema.frameSize() > aSize || detail::readLittleEndian<uint64_t>(frame) != aSchema.fingerprint) {
+                return 0;
+            }
+
+            auto const * const payload { frame + sizeof(uint64_t) };
+            for (auto const & entry: aSchema.entries) {
+                size_t applied { 0 };
+                this->applyRecord(std::index_sequence_for<TForwarders...>{}, entry.id, aObj,
+                                  payload + entry.offset, entry.size, applied);
+            }
+            return aSchema.frameSize();
+        }
+    private:
+        /**
+         * @brief      Finds the applier by the tag id and applies the record
+         *
+         * @return     false, if the tag is unknown or the record is truncated
+         */
+        template<size_t ... Idx>
+        bool applyRecord(std::index_sequence<Idx...>, uint64_t aId, object_t & aObj,
+                         unsigned char const * aIn, size_t aAvailable, size_t & aPayload) const {
+            return ((get<Idx>(m_appliers).id() == aId
+                     && applyOne<Idx>(aObj, aIn, aAvailable, aPayload)) || ...);
+        }
+
+        /**
+         * @brief      Applies the record by the concrete applier
+         *
+         * @tparam     Idx    Index of the applier
+         */
+        template<size_t Idx>
+        bool applyOne(object_t & aObj, unsigned char const * aIn, size_t aAvailable, size_t & aPayload) const {
+            constexpr size_t PAYLOAD { flat_tuple_element_t<Idx, flat_tuple<TForwarders...>>::PAYLOAD };
+            if (PAYLOAD > aAvailable) {
+                return false;
+            }
+
+            get<Idx>(m_appliers)(aObj, aIn);
+            aPayload = PAYLOAD;
+            return true;
+        }
+
+        flat_tuple<TForwarders...>   m_appliers;
+    };
+
+    /* class deduction guides */
+    template<typename ... T>
+    explicit object_apply(T ...) -> object_apply<T...>;
+
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__OBJECT_APPLY__H */
@@ -26,8 +26,16 @@
 #include <chain_invoke.h>
 #include <function_info.h>
 #include <metaprogramming_base.h>
+#include <tag_string.h>
+#include <field_mask.h>
+#include <delta_state.h>
+#include <version_stamp.h>
+#include <invoke_stats.h>
+#include <object_schema.h>
 
 /* STL */
+#include <cstddef>
+#include <cstdint>
 #include <tuple>
 #include <array>
 #include <type_traits>
@@ -50,7 +58,8 @@ namespace mil {
         using object_t   = TObjectType;
         using acceptor_t = TResultAcceptor;
 
-        using invoker_ptr_t = void(*)(object_t &, char const *, acceptor_t &);
+        using invoker_ptr_t           = bool(*)(object_t &, char const *, acceptor_t &, uint64_t *, bool);
+        using versioned_invoker_ptr_t = bool(*)(object_t &, char const *, acceptor_t &, uint64_t &, bool);
 
         /**
          * @brief      Creates the delayed invoker
@@ -62,8 +71,25 @@ namespace mil {
          */
         template<auto ... fx>
         explicit constexpr delayed_invoke(values_list<fx...>, char const * aTag)
-            : m_invokerPtr { &theInvoker<fx...> }
-            , m_tag        { aTag               }
+            : m_invokerPtr          { &theInvoker<char const *, fx...>           }
+            , m_versionedInvokerPtr { versionedInvoker<char const *, fx...>()   }
+            , m_leaves              { &detail::leaf_fields<detail::chain_leaves_t<fx...>>::LAYOUT }
+            , m_tag                 { aTag                                       }
+        {}
+
+        /**
+         * @brief      Creates the delayed invoker with the compile-time tag,
+         *             the acceptor gets the tag object instead of the string
+         *
+         * @tparam     fx     Functions chain to invoke
+         * @tparam     cs     Characters of the tag
+         */
+        template<auto ... fx, char ... cs>
+        explicit constexpr delayed_invoke(values_list<fx...>, tag_string<cs...>)
+            : m_invokerPtr          { &theInvoker<tag_string<cs...>, fx...>          }
+            , m_versionedInvokerPtr { versionedInvoker<tag_string<cs...>, fx...>()  }
+            , m_leaves              { &detail::leaf_fields<detail::chain_leaves_t<fx...>>::LAYOUT }
+            , m_tag                 { tag_string<cs...>::name                        }
         {}
 
         /**
@@ -75,22 +101,166 @@ namespace mil {
          * @param      aAcceptor    Acceptor to pass the value
          */
         constexpr void operator()(object_t & aObject, acceptor_t & aAcceptor) const {
-            (*m_invokerPtr)(aObject, m_tag, aAcceptor);
+            (*m_invokerPtr)(aObject, m_tag, aAcceptor, nullptr, false);
+        }
+
+        /**
+         * @brief      Delta invoke, executes the memorized methods chain and
+         *             passes the result into the acceptor only when it
+         *             differs from the last emitted one
+         *
+         * @param      aObject      Object to invoke
+         * @param      aAcceptor    Acceptor to pass the value
+         * @param      aHash        Hash of the last emitted result, updated
+         *                          when the result is emitted
+         * @param      aEmitted     true, if the result was emitted before
+         *
+         * @return     true, if the result is passed into the acceptor
+         */
+        bool operator()(object_t & aObject, acceptor_t & aAcceptor, uint64_t & aHash, bool aEmitted) const {
+            return (*m_invokerPtr)(aObject, m_tag, aAcceptor, &aHash, aEmitted);
+        }
+
+        /**
+         * @brief      Versioned invoke, executes the memorized methods chain
+         *             and passes the result into the acceptor, unless the
+         *             first object of the chain with the version stamp has
+         *             the same stamp as the last time
+         *
+         * @param      aObject      Object to invoke
+         * @param      aAcceptor    Acceptor to pass the value
+         * @param      aStamp       The last seen stamp, updated by the call
+         * @param      aKnown       true, if aStamp was set before
+         *
+         * @return     true, if the result is passed into the acceptor
+         */
+        bool invokeIfChanged(object_t & aObject, acceptor_t & aAcceptor, uint64_t & aStamp, bool aKnown) const {
+            if (nullptr == m_versionedInvokerPtr) {
+                return (*m_invokerPtr)(aObject, m_tag, aAcceptor, nullptr, false);
+            }
+            return (*m_versionedInvokerPtr)(aObject, m_tag, aAcceptor, aStamp, aKnown);
+        }
+
+        /**
+         * @brief      Instrumented invoke, same as the plain one, but records
+         *             the duration of the chain and the acceptor into the tag
+         *             statistics
+         *
+         * @param      aObject      Object to invoke
+         * @param      aAcceptor    Acceptor to pass the value
+         * @param      aStats       Statistics of the tag
+         */
+        void operator()(object_t & aObject, acceptor_t & aAcceptor, tag_stats & aStats) const {
+            uint64_t const begin { detail::readTicks() };
+            (*m_invokerPtr)(aObject, m_tag, aAcceptor, nullptr, false);
+            aStats.record(detail::readTicks() - begin);
+        }
+
+        /**
+         * @brief      Returns the associated tag
+         */
+        constexpr char const * tag() const noexcept {
+            return m_tag;
+        }
+
+        /**
+         * @brief      Returns the leaf values of the chain
+         */
+        constexpr leaf_layout const & leaves() const noexcept {
+            return *m_leaves;
         }
     private:
         /**
          * @brief      The private invoker, performs chain invoke for the
          *             arguments for the object passed, marks with tag and
-         *             passes all the results into the acceptor
+         *             passes the result into the acceptor. Serves both the
+         *             plain and the delta invokes, so the chain is
+         *             instantiated once: with the hash passed the result is
+         *             emitted only, if it's hash differs from the last emitted
+         *             one. The results, which can't be hashed (see
+         *             is_value_hashable), are always emitted
          *
+         * @tparam     TTag       Type of the tag, `char const *` or the
+         *                        compile-time tag
          * @tparam     fx         Method addresses
+         *
          * @param      aObject    Object to start chain from
          * @param      aTag       Associated tag
          * @param      aAcceptor  The acceptor
+         * @param      aHash      Hash of the last emitted result, nullptr for
+         *                        the plain invoke
+         * @param      aEmitted   true, if the result was emitted before
+         *
+         * @return     true, if the result is passed into the acceptor
          */
-        template<auto ... fx>
-        static constexpr void theInvoker(object_t & aObject, char const * aTag, acceptor_t & aAcceptor) {
-            aAcceptor(aTag, chainInvoke(aObject, fx...));
+        template<typename TTag, auto ... fx>
+        static constexpr bool theInvoker(object_t & aObject, char const * aTag, acceptor_t & aAcceptor,
+                                         uint64_t * aHash, bool aEmitted) {
+            return chainInvokeWith<fx...>(aObject, [&](auto const & aResult) {
+                if constexpr (is_value_hashable_v<std::decay_t<decltype(aResult)>>) {
+                    if (nullptr != aHash) {
+                        uint64_t const hash { valueHash(aResult) };
+                        if (aEmitted && hash == *aHash) {
+                            return false;
+                        }
+                        *aHash = hash;
+                    }
+                } else {
+                    (void)aHash;
+                    (void)aEmitted;
+                }
+
+                accept<TTag>(aAcceptor, aTag, aResult);
+                return true;
+            });
+        }
+
+        /**
+         * @brief      Returns the versioned invoker, nullptr for the chains
+         *             without objects exposing the version stamp, the plain
+         *             invoker is used for them instead
+         *
+         * @tparam     TTag       Type of the tag
+         * @tparam     fx         Method addresses
+         */
+        template<typename TTag, auto ... fx>
+        static constexpr versioned_invoker_ptr_t versionedInvoker() noexcept {
+            if constexpr (chain_has_version_stamp_v<fx...>) {
+                return &theVersionedInvoker<TTag, fx...>;
+            } else {
+                return nullptr;
+            }
+        }
+
+        /**
+         * @brief      Same as above, but skips the chain, while the version
+         *             stamp of it's first stamped object stays the same
+         *
+         * @tparam     TTag       Type of the tag, `char const *` or the
+         *                        compile-time tag
+         * @tparam     fx         Method addresses
+         */
+        template<typename TTag, auto ... fx>
+        static bool theVersionedInvoker(object_t & aObject, char const * aTag, acceptor_t & aAcceptor,
+                                        uint64_t & aStamp, bool aKnown) {
+            return chainInvokeIfChanged<fx...>(aObject, aStamp, aKnown, [&](auto const & aResult) {
+                accept<TTag>(aAcceptor, aTag, aResult);
+            });
+        }
+
+        /**
+         * @brief      Passes the result into the acceptor with the tag object
+         *             for the compile-time tags, and with the string otherwise
+         *
+         * @tparam     TTag       Type of the tag
+         */
+        template<typename TTag, typename TResult>
+        static void accept(acceptor_t & aAcceptor, char const * aTag, TResult const & aResult) {
+            if constexpr (is_tag_string_v<TTag>) {
+                aAcceptor(TTag{}, aResult);
+            } else {
+                aAcceptor(aTag, aResult);
+            }
         }
 
         /**
@@ -98,6 +268,17 @@ namespace mil {
          */
         invoker_ptr_t m_invokerPtr;
 
+        /**
+         * @brief      Pointer to a concrete versioned invoker specialization,
+         *             nullptr, if the chain has no stamped objects
+         */
+        versioned_invoker_ptr_t m_versionedInvokerPtr;
+
+        /**
+         * @brief      Leaf values of the chain, for the schema
+         */
+        leaf_layout const * m_leaves;
+
         /**
          * @brief      Associated tag
          */
@@ -127,18 +308,23 @@ namespace mil {
         /**
          * @brief      Supporting forwarding type
          *
+         * @tparam     TTag   Type of the tag, `char const *` or the
+         *                    compile-time tag
          * @tparam     fx
          */
-        template<auto ... fx>
+        template<typename TTag, auto ... fx>
         struct delayed_invoke_forwarder {
-            using cl = typename first_class<decltype(fx)...>::type;
+            using cl      = typename first_class<decltype(fx)...>::type;
+            using chain_t  = values_list<fx...>;
+            using tag_t    = TTag;
+            using leaves_t = chain_leaves_t<fx...>;
 
             /**
              * @brief      Creates the forwarder
              *
              * @param      Tag to use
              */
-            explicit constexpr delayed_invoke_forwarder(char const * aTag)
+            explicit constexpr delayed_invoke_forwarder(TTag aTag)
                 : m_tag { aTag }
             {}
 
@@ -153,12 +339,92 @@ namespace mil {
             constexpr auto getDelayedInvoke() const noexcept {
                 return delayed_invoke<cl, TResultAcceptor>{ values_list<fx...>{}, m_tag };
             }
+
+            /**
+             * @brief      Direct invoke operator, executes the methods chain
+             *             without any indirection, so the whole chain is
+             *             visible to the compiler
+             *
+             * @tparam     TResultAcceptor    Type of the acceptor
+             *
+             * @param      aObject      Object to invoke
+             * @param      aAcceptor    Acceptor to pass the value
+             *
+             * @return     Result of the acceptor
+             */
+            template<typename TResultAcceptor>
+            constexpr decltype(auto) operator()(cl & aObject, TResultAcceptor & aAcceptor) const {
+                return chainInvokeWith<fx...>(aObject, [&](auto const & aResult) -> decltype(auto) {
+                    return aAcceptor(m_tag, aResult);
+                });
+            }
+
+            /**
+             * @brief      Returns the associated tag
+             */
+            constexpr TTag tag() const noexcept {
+                return m_tag;
+            }
         private:
             /**
              * @brief      Associated tag
              */
-            char const * m_tag;
+            TTag m_tag;
+        };
+
+        /**
+         * @brief      Returns id of the compile-time tag, zero for the runtime
+         *             tags
+         *
+         * @tparam     TTag    Type of the tag
+         */
+        template<typename TTag>
+        constexpr uint64_t compileTimeTagId() noexcept {
+            if constexpr (is_tag_string_v<TTag>) {
+                return TTag::id;
+            } else {
+                return 0;
+            }
+        }
+
+        /**
+         * @brief      Returns ids of all the compile-time tags
+         *
+         * @tparam     TTags    Types of the tags
+         */
+        template<typename ... TTags>
+        constexpr auto compileTimeTagIds() noexcept {
+            std::array<uint64_t, sizeof...(TTags) + 1> ids { };
+            size_t count { 0 };
+            ((is_tag_string_v<TTags> ? void(ids[count++] = compileTimeTagId<TTags>()) : void()), ...);
+            return ids;
+        }
+
+        /**
+         * @brief      Returns class of the object to invoke for the delayed
+         *             invoke forwarders. Also checks, that there are no
+         *             collisions of the compile-time tags
+         *
+         * @tparam     TForwarders    Types of the delayed invoke forwarders
+         */
+        template<typename ... TForwarders>
+        struct invokers_class {
+            static constexpr size_t TAGS_COUNT { (size_t{ 0 } + ... + size_t{ is_tag_string_v<typename TForwarders::tag_t> }) };
+            static constexpr auto   TAG_IDS    { compileTimeTagIds<typename TForwarders::tag_t...>() };
+
+            static_assert(uniqueTagIds(TAG_IDS, TAGS_COUNT),
+                          "Compile-time tags collision: several delayedInvoke have the same tag id");
+
+            using type = typename first_t<TForwarders...>::cl;
         };
+
+        /**
+         * @brief      stl's _t standalone type
+         *
+         * @tparam     TForwarders    Types of the delayed invoke forwarders
+         */
+        template<typename ... TForwarders>
+        using invokers_class_t = typename invokers_class<TForwarders...>::type;
     } /* end of namespace detail */
 
     /**
@@ -191,7 +457,24 @@ namespace mil {
      */
     template<auto ... fx>
     constexpr auto delayedInvoke(char const * tag) {
-        return detail::delayed_invoke_forwarder<fx...>{ tag };
+        return detail::delayed_invoke_forwarder<char const *, fx...>{ tag };
+    }
+
+    /**
+     * @brief      Creates the delayed invoke with the compile-time tag, the
+     *             acceptor gets the tag object, e.g. `"name"_tag`, so it's able
+     *             to use the tag id in compile time
+     *
+     * @tparam     fx     Methods to invoke
+     * @tparam     cs     Characters of the tag
+     *
+     * @param      tag    Associated tag
+     *
+     * @return     Delayed invoke object
+     */
+    template<auto ... fx, char ... cs>
+    constexpr auto delayedInvoke(tag_string<cs...> tag) {
+        return detail::delayed_invoke_forwarder<tag_string<cs...>, fx...>{ tag };
     }
 
 
@@ -232,13 +515,143 @@ namespace mil {
                 invoker(aObj, aAcceptor);
             }
         }
+
+        /**
+         * @brief      Invokes only the invokers selected by the mask, the rest
+         *             chains are not invoked at all. The cost depends on the
+         *             number of the selected invokers, not on N
+         *
+         * @param      aObj       The object
+         * @param      aAcceptor  The acceptor
+         * @param      aMask      Mask of the invokers to invoke
+         */
+        constexpr void operator()(object_t & aObj, acceptor_t & aAcceptor, field_mask<N> const & aMask) const {
+            aMask.forEach([&](size_t aIdx) {
+                m_delayed_invokers[aIdx](aObj, aAcceptor);
+            });
+        }
+
+        /**
+         * @brief      Same as above, but for the precompiled selection list
+         *
+         * @param      aObj         The object
+         * @param      aAcceptor    The acceptor
+         * @param      aSelection   The selected invokers
+         */
+        constexpr void operator()(object_t & aObj, acceptor_t & aAcceptor, field_selection<N> const & aSelection) const {
+            for (auto const idx: aSelection) {
+                m_delayed_invokers[idx](aObj, aAcceptor);
+            }
+        }
+
+        /**
+         * @brief      Delta snapshot: invokes all the registered invokers, but
+         *             passes into the acceptor only the results changed since
+         *             the last snapshot with the same state
+         *
+         * @note       The getters are still invoked, the acceptor work is
+         *             saved (serialization, transfer), so it pays off for the
+         *             expensive acceptors only
+         *
+         * @param      aObj       The object
+         * @param      aAcceptor  The acceptor
+         * @param      aState     The delta state of the object
+         *
+         * @return     Mask of the invokers, which results are passed into the
+         *             acceptor
+         */
+        field_mask<N> operator()(object_t & aObj, acceptor_t & aAcceptor, delta_state<N> & aState) const {
+            field_mask<N> changed { };
+            for (size_t i { 0 }; i < N; ++i) {
+                if (m_delayed_invokers[i](aObj, aAcceptor, aState.hashes[i], aState.emitted.test(i))) {
+                    changed.set(i);
+                    aState.emitted.set(i);
+                }
+            }
+            return changed;
+        }
+
+        /**
+         * @brief      Versioned snapshot: invokes the registered invokers,
+         *             skipping the ones, which first object with the version
+         *             stamp (see has_version_stamp) didn't change since the
+         *             last snapshot with the same state. Getters after such
+         *             object are not invoked at all
+         *
+         * @param      aObj       The object
+         * @param      aAcceptor  The acceptor
+         * @param      aState     The version state of the object, one slot
+         *                        per invoker
+         *
+         * @return     Mask of the invokers, which results are passed into the
+         *             acceptor
+         */
+        field_mask<N> operator()(object_t & aObj, acceptor_t & aAcceptor, version_state<N> & aState) const {
+            field_mask<N> invoked { };
+            for (size_t i { 0 }; i < N; ++i) {
+                if (m_delayed_invokers[i].invokeIfChanged(aObj, aAcceptor, aState.stamps[i], aState.known.test(i))) {
+                    invoked.set(i);
+                    aState.known.set(i);
+                }
+            }
+            return invoked;
+        }
+
+        /**
+         * @brief      Instrumented snapshot: invokes all the registered
+         *             invokers and records the count, the duration and the
+         *             latency histogram of every one into the statistics.
+         *             The plain overload is untouched, so the code without
+         *             the statistics is the same as before
+         *
+         * @param      aObj       The object
+         * @param      aAcceptor  The acceptor
+         * @param      aStats     The statistics, may be read by the other
+         *                        threads meanwhile
+         */
+        void operator()(object_t & aObj, acceptor_t & aAcceptor, invoke_stats<N> & aStats) const {
+            for (size_t i { 0 }; i < N; ++i) {
+                m_delayed_invokers[i](aObj, aAcceptor, aStats.tags[i]);
+            }
+        }
+
+        /**
+         * @brief      Returns number of the registered invokers
+         */
+        static constexpr size_t size() noexcept {
+            return N;
+        }
+
+        /**
+         * @brief      Returns the registered invoker
+         *
+         * @param      aIdx    Index of the invoker, in the registration order
+         */
+        constexpr delayed_invoke_t const & operator[](size_t aIdx) const noexcept {
+            return m_delayed_invokers[aIdx];
+        }
+
+        /**
+         * @brief      Returns the schema: the tags, the leaf types, their
+         *             sizes and offsets in the frame, and the fingerprint.
+         *             It's the constant expression for the constexpr invoke
+         */
+        constexpr object_schema<N> schema() const noexcept {
+            std::array<char const *, N>          tags    { };
+            std::array<leaf_layout const *, N>   layouts { };
+            for (size_t i { 0 }; i < N; ++i) {
+                tags[i]    = m_delayed_invokers[i].tag();
+                layouts[i] = &m_delayed_invokers[i].leaves();
+            }
+            return detail::makeSchema(tags, layouts);
+        }
     private:
         std::array<delayed_invoke_t, N>   m_delayed_invokers;
     };
 
     /* class deduction guides */
     template<typename TResultAcceptor, typename ... T>
-    explicit object_invoke(acceptor<TResultAcceptor>, T ...) -> object_invoke<typename first_t<T...>::cl, sizeof...(T), TResultAcceptor>;
+    explicit object_invoke(acceptor<TResultAcceptor>, T ...) -> object_invoke<detail::invokers_class_t<T...>, sizeof...(T), TResultAcceptor>;
 
 } /* end of namespace mil */
 
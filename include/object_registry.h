@@ -0,0 +1,332 @@
+/**
+ * @file      object_registry.h
+ *
+ * @brief     Contains the registry of the object invokes for the different
+ *            root types, which dispatches the objects by the compile-time
+ *            type index through the flat jump table
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__OBJECT_REGISTRY__H
+#define INCLUDE__OBJECT_REGISTRY__H
+
+/* library parts */
+#include <metaprogramming_base.h>
+
+/* STL */
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <type_traits>
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      The type-erased reference to the object of the registry:
+     *             the object and the compile-time index of it's type
+     */
+    struct object_ref {
+        void *   object;
+        size_t   type;
+    };
+
+    /**
+     * @brief      detail component namespace
+     */
+    namespace detail {
+        /**
+         * @brief      Returns index of the first true value, or the count, if
+         *             there is no such
+         *
+         * @param      aMatches    The values
+         */
+        template<size_t N>
+        constexpr size_t firstMatch(std::array<bool, N> const & aMatches) noexcept {
+            for (size_t i { 0 }; i < N; ++i) {
+                if (aMatches[i]) {
+                    return i;
+                }
+            }
+            return N;
+        }
+
+        /**
+         * @brief      Returns true, if every index is equal to it's position,
+         *             i.e. the first match of every type is the type itself
+         *
+         * @param      aIndexes    The indexes
+         */
+        template<size_t N>
+        constexpr bool identityIndexes(std::array<size_t, N> const & aIndexes) noexcept {
+            for (size_t i { 0 }; i < N; ++i) {
+                if (aIndexes[i] != i) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+/** @{ */
+/* is_registry_invoke meta-function */
+        /**
+         * @brief      Initial definition, the invoke can't be registered
+         *
+         * @tparam     T    Type of the invoke
+         */
+        template<typename T, typename = void>
+        struct is_registry_invoke : std::false_type {};
+
+        /**
+         * @brief      Overload for the invokes, which are called through the
+         *             const reference with the object and the acceptor and
+         *             return nothing
+         *
+         * @tparam     T    Type of the invoke
+         */
+        template<typename T>
+        struct is_registry_invoke<T, std::void_t<decltype(std::declval<T const &>()(std::declval<typename T::object_t &>(),
+                                                                                    std::declval<typename T::acceptor_t &>()))>>
+            : std::is_void<decltype(std::declval<T const &>()(std::declval<typename T::object_t &>(),
+                                                              std::declval<typename T::acceptor_t &>()))> {};
+/** @} */
+    } /* end of namespace detail */
+
+    /**
+     * @brief      The registry of the object invokes for the different root
+     *             types. The object is dispatched to the invoke of it's type
+     *             in compile time, or by the type index of the object_ref via
+     *             the flat table of the function pointers, without the
+     *             virtual calls and the maps
+     *
+     * @note       The batch overload invokes every run of the same type
+     *             objects by the single dispatch, so the invokers of the
+     *             type run back to back. sort() groups the mixed objects by
+     *             the type, so every type has the single run
+     *
+     * @note       The object_ref shall be made by ref() of the same registry,
+     *             the type index isn't checked by the dispatch
+     *
+     * @tparam     TInvokes    Types of the object invokes: object_invoke,
+     *                         inline_object_invoke or trie_object_invoke. The
+     *                         object types shall be unique and the acceptor
+     *                         types shall be the same
+     */
+    template<typename ... TInvokes>
+    struct object_registry {
+    public:
+        using acceptor_t = typename first_t<TInvokes...>::acceptor_t;
+        using invokes_t  = flat_tuple<TInvokes...>;
+
+        static_assert((std::is_same_v<acceptor_t, typename TInvokes::acceptor_t> && ...),
+                      "All the invokes of the registry shall have the same acceptor type");
+
+        static_assert((detail::is_registry_invoke<TInvokes>::value && ...),
+                      "The registry supports object_invoke, inline_object_invoke and trie_object_invoke only");
+
+        static constexpr size_t TYPES_COUNT { sizeof...(TInvokes) };
+
+        /**
+         * @brief      Index of the object type in the registry
+         *
+         * @tparam     T    Type of the object
+         */
+        template<typename T>
+        static constexpr size_t type_index_v {
+            detail::firstMatch(std::array<bool, TYPES_COUNT>{ std::is_same_v<std::remove_cv_t<T>, typename TInvokes::object_t>... })
+        };
+
+        static_assert(detail::identityIndexes(std::array<size_t, TYPES_COUNT>{ type_index_v<typename TInvokes::object_t>... }),
+                      "The object types of the registry shall be unique");
+
+        /**
+         * @brief      Creates the registry
+         *
+         * @param      aInvokes    The object invokes
+         */
+        explicit constexpr object_registry(TInvokes const & ... aInvokes)
+            : m_invokes { aInvokes... }
+        {}
+
+        /**
+         * @brief      Makes the type-erased reference to the object
+         *
+         * @param      aObj    The object
+         */
+        template<typename T>
+        static constexpr object_ref ref(T & aObj) noexcept {
+            static_assert(type_index_v<T> < TYPES_COUNT, "The object type isn't registered");
+            return object_ref{ &aObj, type_index_v<T> };
+        }
+
+        /**
+         * @brief      Invokes the invoke of the object type, resolved in
+         *             compile time, the overload is enabled only for the
+         *             registered types
+         *
+         * @param      aObj        The object
+         * @param      aAcceptor   The acceptor
+         */
+        template<typename T, typename = std::enable_if_t<(type_index_v<T> < TYPES_COUNT)>>
+        constexpr void operator()(T & aObj, acceptor_t & aAcceptor) const {
+            get<type_index_v<T>>(m_invokes)(aObj, aAcceptor);
+        }
+
+        /**
+         * @brief      Invokes the invoke of the referenced object type, by
+         *             the single indirect call through the jump table
+         *
+         * @param      aRef        The object, made by ref()
+         * @param      aAcceptor   The acceptor
+         */
+        void operator()(object_ref aRef, acceptor_t & aAcceptor) const {
+            (*SINGLE_INVOKERS[aRef.type])(m_invokes, aRef.object, aAcceptor);
+        }
+
+        /**
+         * @brief      Invokes all the objects, every run of the objects of
+         *             the same type is dispatched once
+         *
+         * @param      aRefs        Pointer to the first object, the objects
+         *                          are made by ref()
+         * @param      aCount       Number of the objects
+         * @param      aAcceptor    The acceptor
+         */
+        void operator()(object_ref const * aRefs, size_t aCount, acceptor_t & aAcceptor) const {
+            auto const * const end { aRefs + aCount };
+            while (aRefs != end) {
+                auto const * const run { std::find_if(aRefs, end, [type = aRefs->type](object_ref const & aRef) {
+                    return aRef.type != type;
+                }) };
+                (*INVOKERS[aRefs->type])(m_invokes, aRefs, run, aAcceptor);
+                aRefs = run;
+            }
+        }
+
+        /**
+         * @brief      Same as above, but for any contiguous range
+         *
+         * @tparam     TRange    Type of the range (array, vector, etc)
+         */
+        template<typename TRange>
+        void operator()(TRange const & aRange, acceptor_t & aAcceptor) const {
+            (*this)(std::data(aRange), std::size(aRange), aAcceptor);
+        }
+
+        /**
+         * @brief      Groups the objects by the type, in the registration
+         *             order of the types, the objects of the same type are
+         *             ordered by the address
+         *
+         * @param      aRefs     Pointer to the first object
+         * @param      aCount    Number of the objects
+         */
+        static void sort(object_ref * aRefs, size_t aCount) {
+            std::sort(aRefs, aRefs + aCount, [](object_ref const & aLeft, object_ref const & aRight) {
+                return aLeft.type != aRight.type ? aLeft.type < aRight.type
+                                                 : std::less<void *>{}(aLeft.object, aRight.object);
+            });
+        }
+
+        /**
+         * @brief      Same as above, but for any contiguous range
+         *
+         * @tparam     TRange    Type of the range (array, vector, etc)
+         */
+        template<typename TRange>
+        static void sort(TRange & aRange) {
+            sort(std::data(aRange), std::size(aRange));
+        }
+    private:
+        using invoker_ptr_t        = void(*)(invokes_t const &, object_ref const *, object_ref const *, acceptor_t &);
+        using single_invoker_ptr_t = void(*)(invokes_t const &, void *, acceptor_t &);
+
+        /**
+         * @brief      Invokes the single object
+         *
+         * @tparam     Idx    Index of the type
+         */
+        template<size_t Idx>
+        static void invokeOne(invokes_t const & aInvokes, void * aObj, acceptor_t & aAcceptor) {
+            using object_t = typename flat_tuple_element_t<Idx, invokes_t>::object_t;
+
+            get<Idx>(aInvokes)(*static_cast<object_t *>(aObj), aAcceptor);
+        }
+
+        /**
+         * @brief      Invokes the run of the objects of the same type
+         *
+         * @tparam     Idx    Index of the type
+         */
+        template<size_t Idx>
+        static void invokeRun(invokes_t const & aInvokes, object_ref const * aBegin, object_ref const * aEnd,
+                              acceptor_t & aAcceptor) {
+            using object_t = typename flat_tuple_element_t<Idx, invokes_t>::object_t;
+
+            auto const & invoke { get<Idx>(aInvokes) };
+            for (; aBegin != aEnd; ++aBegin) {
+                invoke(*static_cast<object_t *>(aBegin->object), aAcceptor);
+            }
+        }
+
+        /**
+         * @brief      Makes the jump table of the runs
+         *
+         * @tparam     Idx    Indexes of the types
+         */
+        template<size_t ... Idx>
+        static constexpr std::array<invoker_ptr_t, TYPES_COUNT> makeInvokers(std::index_sequence<Idx...>) noexcept {
+            return { &invokeRun<Idx>... };
+        }
+
+        /**
+         * @brief      Makes the jump table of the single objects
+         *
+         * @tparam     Idx    Indexes of the types
+         */
+        template<size_t ... Idx>
+        static constexpr std::array<single_invoker_ptr_t, TYPES_COUNT> makeSingleInvokers(std::index_sequence<Idx...>) noexcept {
+            return { &invokeOne<Idx>... };
+        }
+
+        static constexpr std::array<invoker_ptr_t, TYPES_COUNT> INVOKERS {
+            makeInvokers(std::index_sequence_for<TInvokes...>{})
+        };
+
+        static constexpr std::array<single_invoker_ptr_t, TYPES_COUNT> SINGLE_INVOKERS {
+            makeSingleInvokers(std::index_sequence_for<TInvokes...>{})
+        };
+
+        invokes_t m_invokes;
+    };
+
+    /* class deduction guides */
+    template<typename ... T>
+    explicit object_registry(T ...) -> object_registry<T...>;
+
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__OBJECT_REGISTRY__H */
@@ -0,0 +1,334 @@
+/**
+ * @file      object_schema.h
+ *
+ * @brief     Contains the compile-time schema of the object invoke: the tags,
+ *            the leaf types of every tag, their sizes and offsets in the
+ *            fixed-layout frame and in the flat snapshot, and the stable
+ *            64-bit fingerprint of all that
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__OBJECT_SCHEMA__H
+#define INCLUDE__OBJECT_SCHEMA__H
+
+/* library parts */
+#include <chain_invoke.h>
+#include <metaprogramming_base.h>
+#include <tag_string.h>
+#include <binary_layout.h>
+
+/* STL */
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <tuple>
+#include <type_traits>
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      Kind of the leaf value. The values are the part of the
+     *             fingerprint, so they shall never be changed
+     */
+    enum class leaf_kind : uint8_t {
+        unsupported      = 0,
+        boolean          = 1,
+        signed_integer   = 2,
+        unsigned_integer = 3,
+        floating_point   = 4,
+        enumeration      = 5
+    };
+
+    /**
+     * @brief      The leaf value of the tag, the offset is packed, the flat
+     *             offset is aligned to the size of the value
+     */
+    struct schema_field {
+        leaf_kind   kind;
+        uint32_t    size;
+        uint32_t    offset;
+        uint32_t    flatOffset;
+    };
+
+    /**
+     * @brief      The leaf values of the methods chain
+     */
+    struct leaf_layout {
+        schema_field const *   fields;
+        size_t                 count;
+        size_t                 size;
+        size_t                 flatSize;
+        bool                   fixed;
+    };
+
+    /**
+     * @brief      The tag of the schema, the offset is counted from the
+     *             beginning of the frame payload, i.e. after the fingerprint,
+     *             the flat offset is counted from the beginning of the flat
+     *             snapshot
+     */
+    struct schema_entry {
+        char const *           tag;
+        uint64_t               id;
+        schema_field const *   fields;
+        size_t                 fieldsCount;
+        size_t                 offset;
+        size_t                 size;
+        size_t                 flatOffset;
+        size_t                 flatSize;
+    };
+
+    /**
+     * @brief      The schema of the object invoke: all the tags in the
+     *             registration order. The frame is `[u64 fingerprint]`
+     *             followed by the results of all the tags one after another,
+     *             using the binary layout, without tags
+     *
+     * @note       The fingerprint is the FNV-1a hash of the tag names, the
+     *             order of the tags, the kinds and the sizes of the leaves,
+     *             so it doesn't depend on the compiler and the platform, as
+     *             long as the sizes of the types are the same
+     *
+     * @tparam     N    Number of the tags
+     */
+    template<size_t N>
+    struct object_schema {
+        std::array<schema_entry, N>   entries     { };
+        size_t                        size        { 0 };
+        size_t                        flatSize    { 0 };
+        uint64_t                      fingerprint { 0 };
+        bool                          fixed       { true };
+
+        /**
+         * @brief      Returns size of the whole frame, including the
+         *             fingerprint
+         */
+        constexpr size_t frameSize() const noexcept {
+            return sizeof(uint64_t) + size;
+        }
+
+        /**
+         * @brief      Returns index of the tag, or N, if there is no such
+         *
+         * @param      aTag    The tag name
+         */
+        constexpr size_t find(char const * aTag) const noexcept {
+            uint64_t const id { tagId(aTag) };
+            size_t index { 0 };
+            for (; index < N && entries[index].id != id; ++index) {}
+            return index;
+        }
+    };
+
+    /**
+     * @brief      detail component namespace
+     */
+    namespace detail {
+        /**
+         * @brief      Returns kind of the leaf value
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T>
+        constexpr leaf_kind leafKind() noexcept {
+            if constexpr (!binary_traits<T>::SUPPORTED) {
+                return leaf_kind::unsupported;
+            } else if constexpr (std::is_same_v<T, bool>) {
+                return leaf_kind::boolean;
+            } else if constexpr (std::is_enum_v<T>) {
+                return leaf_kind::enumeration;
+            } else if constexpr (std::is_floating_point_v<T>) {
+                return leaf_kind::floating_point;
+            } else if constexpr (std::is_signed_v<T>) {
+                return leaf_kind::signed_integer;
+            } else {
+                return leaf_kind::unsigned_integer;
+            }
+        }
+
+        /**
+         * @brief      Returns encoded size of the leaf value, zero for the
+         *             values without the binary layout
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T>
+        constexpr uint32_t leafSize() noexcept {
+            if constexpr (binary_traits<T>::SUPPORTED) {
+                return static_cast<uint32_t>(binary_traits<T>::SIZE);
+            } else {
+                return 0;
+            }
+        }
+
+        /**
+         * @brief      Rounds the value up to the multiple of the alignment
+         *
+         * @param      aValue    The value
+         * @param      aAlign    The alignment, power of two
+         */
+        constexpr inline size_t alignUp(size_t aValue, size_t aAlign) noexcept {
+            return (aValue + aAlign - 1) & ~(aAlign - 1);
+        }
+
+        /**
+         * @brief      The layout of the flat snapshot:
+         *             `[u64 fingerprint][u32 tags count][u32 snapshot size]`,
+         *             the table of the u32 offsets of the tags, then the
+         *             results of the tags, every tag is aligned to 8 bytes,
+         *             every value is aligned to it's size. All the integers
+         *             and floating point values are little-endian, the
+         *             padding is zeroed
+         */
+        struct flat_layout {
+            static constexpr size_t HEADER { 16 };
+            static constexpr size_t ALIGN  { 8  };
+
+            /**
+             * @brief      Returns offset of the first tag
+             *
+             * @param      aCount    Number of the tags
+             */
+            static constexpr size_t dataOffset(size_t aCount) noexcept {
+                return alignUp(HEADER + sizeof(uint32_t) * aCount, ALIGN);
+            }
+        };
+
+        /**
+         * @brief      Initial definition, unused
+         */
+        template<typename Tuple>
+        struct leaf_fields;
+
+        /**
+         * @brief      The leaf values of the tag, with the offsets inside the
+         *             result of the tag
+         *
+         * @tparam     T    Types of the leaf values
+         */
+        template<typename ... T>
+        struct leaf_fields<std::tuple<T...>> {
+            static constexpr bool   FIXED { (binary_traits<std::decay_t<T>>::SUPPORTED && ...) };
+            static constexpr size_t SIZE  { (size_t{ 0 } + ... + leafSize<std::decay_t<T>>()) };
+
+            static constexpr std::array<schema_field, sizeof...(T)> make() noexcept {
+                std::array<schema_field, sizeof...(T)> fields { schema_field{ leafKind<std::decay_t<T>>(), leafSize<std::decay_t<T>>(), 0, 0 }... };
+                uint32_t offset     { 0 };
+                uint32_t flatOffset { 0 };
+                for (auto & field: fields) {
+                    field.offset     = offset;
+                    field.flatOffset = 0 == field.size ? flatOffset : static_cast<uint32_t>(alignUp(flatOffset, field.size));
+                    offset          += field.size;
+                    flatOffset       = field.flatOffset + field.size;
+                }
+                return fields;
+            }
+
+            static constexpr std::array<schema_field, sizeof...(T)> FIELDS    { make() };
+            static constexpr size_t                                 FLAT_SIZE {
+                alignUp(0 == sizeof...(T) ? 0 : FIELDS[sizeof...(T) - 1].flatOffset + FIELDS[sizeof...(T) - 1].size, flat_layout::ALIGN)
+            };
+            static constexpr leaf_layout                            LAYOUT    { FIELDS.data(), FIELDS.size(), SIZE, FLAT_SIZE, FIXED };
+        };
+
+        /**
+         * @brief      The leaf values of the methods chain: the decayed
+         *             result of the last method
+         *
+         * @tparam     fx    The methods chain
+         */
+        template<auto ... fx>
+        using chain_leaves_t = values_t<step_result_t<last_t<decltype(fx)...>>>;
+
+        /**
+         * @brief      Mixes the value into the FNV-1a hash, byte by byte in
+         *             the little-endian order
+         *
+         * @param      aHash     The hash
+         * @param      aValue    The value
+         */
+        constexpr inline uint64_t fingerprintMix(uint64_t aHash, uint64_t aValue) noexcept {
+            for (size_t i { 0 }; i < sizeof(aValue); ++i) {
+                aHash ^= (aValue >> (8u * i)) & 0xffu;
+                aHash *= 0x100000001b3ull;
+            }
+            return aHash;
+        }
+
+        /**
+         * @brief      Makes the schema from the tags and the leaves of the
+         *             chains, in the registration order
+         *
+         * @param      aTags       Tags of the chains
+         * @param      aLayouts    Leaves of the chains
+         */
+        template<size_t N>
+        constexpr object_schema<N> makeSchema(std::array<char const *, N> const & aTags,
+                                              std::array<leaf_layout const *, N> const & aLayouts) noexcept {
+            object_schema<N> schema { };
+            schema.fingerprint = 0xcbf29ce484222325ull;
+            schema.flatSize    = flat_layout::dataOffset(N);
+
+            for (size_t i { 0 }; i < N; ++i) {
+                auto const & layout { *aLayouts[i] };
+                schema.entries[i]  = schema_entry{ aTags[i], tagId(aTags[i]), layout.fields, layout.count,
+                                                   schema.size, layout.size, schema.flatSize, layout.flatSize };
+                schema.size       += layout.size;
+                schema.flatSize   += layout.flatSize;
+                schema.fixed       = schema.fixed && layout.fixed;
+                schema.fingerprint = fingerprintMix(schema.fingerprint, schema.entries[i].id);
+                schema.fingerprint = fingerprintMix(schema.fingerprint, layout.count);
+                for (size_t j { 0 }; j < layout.count; ++j) {
+                    schema.fingerprint = fingerprintMix(schema.fingerprint, static_cast<uint64_t>(layout.fields[j].kind));
+                    schema.fingerprint = fingerprintMix(schema.fingerprint, layout.fields[j].size);
+                }
+            }
+            return schema;
+        }
+
+        /**
+         * @brief      Returns index of the entry with the tag id, or the count,
+         *             if there is no such. The tags are expected in the
+         *             registration order, then the entry is found by the
+         *             single comparison, otherwise the entries are scanned
+         *
+         * @param      aEntries    The entries of the schema
+         * @param      aCount      Number of the entries
+         * @param      aNext       Index of the expected entry, updated
+         * @param      aId         Id of the tag
+         */
+        constexpr inline size_t nextEntry(schema_entry const * aEntries, size_t aCount, size_t & aNext, uint64_t aId) noexcept {
+            size_t index { aNext };
+            if (index >= aCount || aEntries[index].id != aId) {
+                for (index = 0; index < aCount && aEntries[index].id != aId; ++index) {}
+                if (index == aCount) {
+                    return aCount;
+                }
+            }
+            aNext = index + 1;
+            return index;
+        }
+    } /* end of namespace detail */
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__OBJECT_SCHEMA__H */
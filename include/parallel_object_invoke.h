@@ -0,0 +1,152 @@
+/**
+ * @file      parallel_object_invoke.h
+ *
+ * @brief     Contains the parallel executor of the object invoke, which
+ *            splits the range of the objects and the registered invokers
+ *            into the chunks and runs them on the thread pool
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__PARALLEL_OBJECT_INVOKE__H
+#define INCLUDE__PARALLEL_OBJECT_INVOKE__H
+
+/* library parts */
+#include <object_invoke.h>
+#include <thread_pool.h>
+
+/* STL */
+#include <cstddef>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      The parallel executor of the object invoke. The work
+     *             (objects x registered invokers) is split into the chunks,
+     *             every chunk is processed by the thread pool with it's own
+     *             acceptor instance, and at the end all the chunk acceptors
+     *             are merged into the caller's one in the chunk order
+     *
+     * @note       The acceptor shall be default constructible and provide
+     *             `void merge(acceptor_t && aOther)`. The merge order doesn't
+     *             depend on the scheduling, for the chunks covering all the
+     *             invokers it's the same as the order of the serial invoke
+     *
+     * @note       Different chunks may invoke the methods of the same object
+     *             concurrently, when the invokers are split into several
+     *             chunks, so the getters shall be safe for that
+     *
+     * @note       When the getter or the acceptor throws, the rest chunks are
+     *             skipped and the exception is rethrown after all the chunks
+     *             are left, nothing is merged into the caller's acceptor then
+     *
+     * @tparam     TObjectInvoke    Type of the object invoke
+     */
+    template<typename TObjectInvoke>
+    struct parallel_object_invoke {
+    public:
+        using object_t   = typename TObjectInvoke::object_t;
+        using acceptor_t = typename TObjectInvoke::acceptor_t;
+
+        /**
+         * @brief      Creates the parallel executor
+         *
+         * @param      aInvoke              The object invoke to execute
+         * @param      aPool                Thread pool to run the chunks
+         * @param      aObjectsPerChunk     Number of objects in a chunk
+         * @param      aInvokersPerChunk    Number of invokers in a chunk, all
+         *                                  the invokers by default
+         */
+        parallel_object_invoke(TObjectInvoke const & aInvoke, thread_pool & aPool,
+                               size_t aObjectsPerChunk = 256,
+                               size_t aInvokersPerChunk = TObjectInvoke::size())
+            : m_invoke           { aInvoke                                   }
+            , m_pool             { aPool                                     }
+            , m_objectsPerChunk  { std::max<size_t>(aObjectsPerChunk, 1)     }
+            , m_invokersPerChunk { std::max<size_t>(aInvokersPerChunk, 1)    }
+        {}
+
+        /**
+         * @brief      Invokes all the registered invokers for every object of
+         *             the range and merges the results into the acceptor
+         *
+         * @param      aObjects     Pointer to the first object
+         * @param      aCount       Number of the objects
+         * @param      aAcceptor    The acceptor to merge all the results to
+         */
+        void operator()(object_t * aObjects, size_t aCount, acceptor_t & aAcceptor) {
+            size_t const objectChunks  { (aCount + m_objectsPerChunk - 1) / m_objectsPerChunk };
+            size_t const invokerChunks { (TObjectInvoke::size() + m_invokersPerChunk - 1) / m_invokersPerChunk };
+            size_t const chunks        { objectChunks * invokerChunks };
+
+            m_acceptors.resize(chunks);
+            for (auto & chunkAcceptor: m_acceptors) {
+                chunkAcceptor = acceptor_t{};
+            }
+
+            m_pool.run(chunks, [&](size_t, size_t aChunk) {
+                size_t const firstObject  { aChunk / invokerChunks * m_objectsPerChunk };
+                size_t const lastObject   { std::min(firstObject + m_objectsPerChunk, aCount) };
+                size_t const firstInvoker { aChunk % invokerChunks * m_invokersPerChunk };
+                size_t const lastInvoker  { std::min(firstInvoker + m_invokersPerChunk, TObjectInvoke::size()) };
+
+                auto & chunkAcceptor { m_acceptors[aChunk] };
+                for (size_t object { firstObject }; object < lastObject; ++object) {
+                    for (size_t invoker { firstInvoker }; invoker < lastInvoker; ++invoker) {
+                        m_invoke[invoker](aObjects[object], chunkAcceptor);
+                    }
+                }
+            });
+
+            for (auto & chunkAcceptor: m_acceptors) {
+                aAcceptor.merge(std::move(chunkAcceptor));
+            }
+        }
+
+        /**
+         * @brief      Same as above, but for any contiguous range
+         *
+         * @tparam     TRange    Type of the range (array, vector, etc)
+         */
+        template<typename TRange>
+        void operator()(TRange & aRange, acceptor_t & aAcceptor) {
+            (*this)(std::data(aRange), std::size(aRange), aAcceptor);
+        }
+    private:
+        TObjectInvoke const &   m_invoke;
+        thread_pool &           m_pool;
+        size_t                  m_objectsPerChunk;
+        size_t                  m_invokersPerChunk;
+
+        /**
+         * @brief      Per-chunk acceptors, kept between the calls to avoid
+         *             allocations
+         */
+        std::vector<acceptor_t> m_acceptors { };
+    };
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__PARALLEL_OBJECT_INVOKE__H */
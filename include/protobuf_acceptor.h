@@ -0,0 +1,446 @@
+/**
+ * @file      protobuf_acceptor.h
+ *
+ * @brief     Contains the acceptor, which writes the results directly in the
+ *            protobuf wire format, the field numbers are taken from the
+ *            object schema
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__PROTOBUF_ACCEPTOR__H
+#define INCLUDE__PROTOBUF_ACCEPTOR__H
+
+/* library parts */
+#include <tag_string.h>
+#include <binary_layout.h>
+#include <object_schema.h>
+
+/* STL */
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      The protobuf wire types
+     */
+    enum class wire_type : uint8_t {
+        varint           = 0,
+        fixed64          = 1,
+        length_delimited = 2,
+        fixed32          = 5
+    };
+
+    /**
+     * @brief      detail component namespace
+     */
+    namespace detail {
+        /**
+         * @brief      Returns the maximal size of the varint of the value
+         *             with the given number of bits
+         *
+         * @param      aBits    Number of the bits
+         */
+        constexpr inline size_t varintMaxSize(size_t aBits) noexcept {
+            return (aBits + 6) / 7;
+        }
+
+        /**
+         * @brief      Returns size of the varint
+         *
+         * @param      aValue    The value
+         */
+        constexpr inline size_t varintSize(uint64_t aValue) noexcept {
+            size_t size { 1 };
+            for (; aValue >= 0x80u; aValue >>= 7) {
+                ++size;
+            }
+            return size;
+        }
+
+        /**
+         * @brief      Writes the varint
+         *
+         * @param      aOut      Output position
+         * @param      aValue    The value
+         *
+         * @return     Position after the varint
+         */
+        inline unsigned char * writeVarint(unsigned char * aOut, uint64_t aValue) noexcept {
+            for (; aValue >= 0x80u; aValue >>= 7) {
+                *aOut++ = static_cast<unsigned char>(aValue | 0x80u);
+            }
+            *aOut++ = static_cast<unsigned char>(aValue);
+            return aOut;
+        }
+
+        /**
+         * @brief      Zigzag encoding of the signed value, so the small
+         *             negative values have the short varints
+         *
+         * @param      aValue    The value
+         */
+        constexpr inline uint64_t zigzag(int64_t aValue) noexcept {
+            return (static_cast<uint64_t>(aValue) << 1) ^ static_cast<uint64_t>(aValue >> 63);
+        }
+
+        /**
+         * @brief      Returns the key of the field
+         *
+         * @param      aField    The field number
+         * @param      aWire     The wire type
+         */
+        constexpr inline uint64_t fieldKey(uint64_t aField, wire_type aWire) noexcept {
+            return (aField << 3) | static_cast<uint64_t>(aWire);
+        }
+
+    /** @{ */
+    /* protobuf_traits meta-function, describes the wire encoding of the type */
+        /**
+         * @brief      Initial definition, the type has no wire encoding
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T, typename = void>
+        struct protobuf_traits {
+            static constexpr bool SUPPORTED { false };
+        };
+
+        /**
+         * @brief      Overload for bool and the integers: bool and unsigned
+         *             integers are the plain varints (`bool`, `uint32`,
+         *             `uint64`), signed integers are zigzag varints (`sint32`,
+         *             `sint64`)
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T>
+        struct protobuf_traits<T, std::enable_if_t<std::is_integral_v<T>>> {
+            static constexpr bool      SUPPORTED { true };
+            static constexpr wire_type WIRE      { wire_type::varint };
+            static constexpr size_t    MAX_SIZE  { std::is_same_v<T, bool> ? 1 : varintMaxSize(8 * sizeof(T)) };
+            static constexpr bool      EXACT     { std::is_same_v<T, bool> };
+
+            static unsigned char * write(unsigned char * aOut, T aValue) noexcept {
+                if constexpr (std::is_same_v<T, bool>) {
+                    *aOut = aValue ? 1u : 0u;
+                    return aOut + 1;
+                } else if constexpr (std::is_signed_v<T>) {
+                    return writeVarint(aOut, zigzag(aValue));
+                } else {
+                    return writeVarint(aOut, aValue);
+                }
+            }
+
+            static constexpr size_t size(T aValue) noexcept {
+                if constexpr (std::is_same_v<T, bool>) {
+                    return 1;
+                } else if constexpr (std::is_signed_v<T>) {
+                    return varintSize(zigzag(aValue));
+                } else {
+                    return varintSize(aValue);
+                }
+            }
+        };
+
+        /**
+         * @brief      Overload for the enums: the varint of the underlying
+         *             value, the negative values are sign-extended to 64 bits,
+         *             as protobuf `enum` does
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T>
+        struct protobuf_traits<T, std::enable_if_t<std::is_enum_v<T>>> {
+            using underlying_t = std::underlying_type_t<T>;
+            using wide_t       = std::conditional_t<std::is_signed_v<underlying_t>, int64_t, uint64_t>;
+
+            static constexpr bool      SUPPORTED { true };
+            static constexpr wire_type WIRE      { wire_type::varint };
+            static constexpr size_t    MAX_SIZE  { varintMaxSize(std::is_signed_v<underlying_t> ? 64 : 8 * sizeof(underlying_t)) };
+            static constexpr bool      EXACT     { false };
+
+            static unsigned char * write(unsigned char * aOut, T aValue) noexcept {
+                return writeVarint(aOut, static_cast<uint64_t>(static_cast<wide_t>(static_cast<underlying_t>(aValue))));
+            }
+
+            static constexpr size_t size(T aValue) noexcept {
+                return varintSize(static_cast<uint64_t>(static_cast<wide_t>(static_cast<underlying_t>(aValue))));
+            }
+        };
+
+        /**
+         * @brief      Overload for float and double: `fixed32` and `fixed64`
+         *             little-endian values
+         *
+         * @tparam     T    Type of the value
+         */
+        template<typename T>
+        struct protobuf_traits<T, std::enable_if_t<std::is_floating_point_v<T> && (4 == sizeof(T) || 8 == sizeof(T))>> {
+            static constexpr bool      SUPPORTED { true };
+            static constexpr wire_type WIRE      { 4 == sizeof(T) ? wire_type::fixed32 : wire_type::fixed64 };
+            static constexpr size_t    MAX_SIZE  { sizeof(T) };
+            static constexpr bool      EXACT     { true };
+
+            static unsigned char * write(unsigned char * aOut, T aValue) noexcept {
+                writeLittleEndian(aOut, aValue);
+                return aOut + sizeof(T);
+            }
+
+            static constexpr size_t size(T) noexcept {
+                return sizeof(T);
+            }
+        };
+    /** @} */
+
+        /**
+         * @brief      Initial definition, unused
+         */
+        template<typename Tuple>
+        struct protobuf_message;
+
+        /**
+         * @brief      The encoding of the result of the methods chain. The
+         *             single value is written as the field itself, the several
+         *             values are written as the nested message, where the
+         *             value `i` has the field number `i + 1`. The keys of the
+         *             nested fields and the size limits are computed in
+         *             compile time
+         *
+         * @tparam     T    Types of the values
+         */
+        template<typename ... T>
+        struct protobuf_message<std::tuple<T...>> {
+            static_assert((protobuf_traits<std::decay_t<T>>::SUPPORTED && ...),
+                          "protobuf_acceptor supports only arithmetic and enum values");
+
+            static constexpr bool   SCALAR   { 1 == sizeof...(T) };
+            static constexpr bool   EXACT    { (protobuf_traits<std::decay_t<T>>::EXACT && ...) };
+            static constexpr size_t CONTENT  { (size_t{ 0 } + ... + protobuf_traits<std::decay_t<T>>::MAX_SIZE) };
+
+            /**
+             * @brief      Makes the keys of the nested fields
+             */
+            template<size_t ... Idx>
+            static constexpr std::array<uint64_t, sizeof...(T)> makeKeys(std::index_sequence<Idx...>) noexcept {
+                return { fieldKey(Idx + 1, protobuf_traits<std::decay_t<T>>::WIRE)... };
+            }
+
+            static constexpr std::array<uint64_t, sizeof...(T)> KEYS { makeKeys(std::index_sequence_for<T...>{}) };
+
+            /**
+             * @brief      Returns the maximal size of the nested message
+             */
+            static constexpr size_t nestedMaxSize() noexcept {
+                size_t size { CONTENT };
+                for (auto key: KEYS) {
+                    size += varintSize(key);
+                }
+                return size;
+            }
+
+            static constexpr size_t NESTED { nestedMaxSize() };
+
+            /**
+             * @brief      Maximal size of the field, the key of the field
+             *             number up to 2^29 takes at most 5 bytes
+             */
+            static constexpr size_t MAX_SIZE { SCALAR ? 5 + CONTENT : 5 + varintMaxSize(64) + NESTED };
+
+            /**
+             * @brief      Writes the whole field
+             *
+             * @param      aOut      Output position
+             * @param      aField    The field number
+             * @param      aTuple    The values
+             *
+             * @return     Position after the field
+             */
+            static unsigned char * write(unsigned char * aOut, uint64_t aField, std::tuple<T...> const & aTuple) noexcept {
+                if constexpr (SCALAR) {
+                    using value_t = std::decay_t<std::tuple_element_t<0, std::tuple<T...>>>;
+
+                    aOut = writeVarint(aOut, fieldKey(aField, protobuf_traits<value_t>::WIRE));
+                    return protobuf_traits<value_t>::write(aOut, std::get<0>(aTuple));
+                } else {
+                    aOut = writeVarint(aOut, fieldKey(aField, wire_type::length_delimited));
+                    if constexpr (EXACT) {
+                        aOut = writeVarint(aOut, NESTED);
+                        return writeNested(aOut, aTuple, std::index_sequence_for<T...>{});
+                    } else if constexpr (NESTED < 0x80u) {
+                        unsigned char * const length { aOut };
+                        unsigned char * const end    { writeNested(aOut + 1, aTuple, std::index_sequence_for<T...>{}) };
+                        *length = static_cast<unsigned char>(end - length - 1);
+                        return end;
+                    } else {
+                        aOut = writeVarint(aOut, nestedSize(aTuple, std::index_sequence_for<T...>{}));
+                        return writeNested(aOut, aTuple, std::index_sequence_for<T...>{});
+                    }
+                }
+            }
+        private:
+            template<size_t ... Idx>
+            static unsigned char * writeNested(unsigned char * aOut, std::tuple<T...> const & aTuple, std::index_sequence<Idx...>) noexcept {
+                ((aOut = writeVarint(aOut, KEYS[Idx]),
+                  aOut = protobuf_traits<std::decay_t<T>>::write(aOut, std::get<Idx>(aTuple))), ...);
+                return aOut;
+            }
+
+            template<size_t ... Idx>
+            static size_t nestedSize(std::tuple<T...> const & aTuple, std::index_sequence<Idx...>) noexcept {
+                return (size_t{ 0 } + ... + (varintSize(KEYS[Idx]) + protobuf_traits<std::decay_t<T>>::size(std::get<Idx>(aTuple))));
+            }
+        };
+    } /* end of namespace detail */
+
+    /**
+     * @brief      The acceptor, which writes the results as the fields of the
+     *             single protobuf message, without any intermediate
+     *             representation. The tag at position `i` of the schema is the
+     *             field number `i + 1`, so the `.proto` of the message follows
+     *             the registration order of the invoke:
+     *
+     *             - the single value is the scalar field: `bool`, `uint32`,
+     *               `uint64`, `sint32`, `sint64`, the enum, `float` or
+     *               `double`
+     *             - the several values are the nested message, where the
+     *               value `i` is the scalar field number `i + 1`
+     *
+     * @note       The tags are expected in the registration order, then the
+     *             field is found by the single comparison of the tag id,
+     *             otherwise by the scan of the schema. The tags, which are
+     *             not in the schema, are skipped. The maximal size of the
+     *             field is computed in compile time, so there is the only
+     *             bounds check per tag. When the field doesn't fit, nothing is
+     *             written and the acceptor is marked as overflowed, all the
+     *             next fields are dropped as well. The schema shall outlive
+     *             the acceptor. The acceptor never allocates
+     */
+    class protobuf_acceptor {
+    public:
+        /**
+         * @brief      Creates the protobuf acceptor
+         *
+         * @param      aBuffer      The output buffer
+         * @param      aCapacity    Size of the output buffer
+         * @param      aSchema      Schema of the invoke
+         */
+        template<size_t N>
+        protobuf_acceptor(void * aBuffer, size_t aCapacity, object_schema<N> const & aSchema) noexcept
+            : m_begin   { static_cast<unsigned char *>(aBuffer) }
+            , m_pos     { m_begin                               }
+            , m_end     { m_begin + aCapacity                   }
+            , m_entries { aSchema.entries.data()                }
+            , m_count   { N                                     }
+        {}
+
+        /**
+         * @brief      Writes the field
+         *
+         * @param      aTag      Associated tag
+         * @param      aTuple    The result of the methods chain
+         */
+        template<typename ... T>
+        void operator()(char const * aTag, std::tuple<T...> const & aTuple) noexcept {
+            this->write(tagId(aTag), aTuple);
+        }
+
+        /**
+         * @brief      Writes the field with the compile-time tag
+         *
+         * @param      <pos>     The compile-time tag
+         * @param      aTuple    The result of the methods chain
+         */
+        template<char ... cs, typename ... T>
+        void operator()(tag_string<cs...>, std::tuple<T...> const & aTuple) noexcept {
+            this->write(tag_string<cs...>::id, aTuple);
+        }
+
+        /**
+         * @brief      Returns the beginning of the written message
+         */
+        unsigned char const * data() const noexcept {
+            return m_begin;
+        }
+
+        /**
+         * @brief      Returns number of the written bytes
+         */
+        size_t size() const noexcept {
+            return static_cast<size_t>(m_pos - m_begin);
+        }
+
+        /**
+         * @brief      Returns true, if any field didn't fit the buffer
+         */
+        bool overflow() const noexcept {
+            return m_overflow;
+        }
+
+        /**
+         * @brief      Starts the new message from the beginning of the buffer
+         */
+        void reset() noexcept {
+            m_pos      = m_begin;
+            m_next     = 0;
+            m_overflow = false;
+        }
+    private:
+        /**
+         * @brief      Writes the whole field
+         *
+         * @param      aTagId    Id of the tag
+         * @param      aTuple    The result of the methods chain
+         */
+        template<typename ... T>
+        void write(uint64_t aTagId, std::tuple<T...> const & aTuple) noexcept {
+            using message_t = detail::protobuf_message<std::tuple<T...>>;
+
+            size_t const index { detail::nextEntry(m_entries, m_count, m_next, aTagId) };
+            if (index == m_count) {
+                return;
+            }
+
+            if (m_overflow || message_t::MAX_SIZE > size_t(m_end - m_pos)) {
+                m_overflow = true;
+                return;
+            }
+
+            m_pos = message_t::write(m_pos, index + 1, aTuple);
+        }
+
+        unsigned char *         m_begin;
+        unsigned char *         m_pos;
+        unsigned char *         m_end;
+        schema_entry const *    m_entries;
+        size_t                  m_count;
+        size_t                  m_next     { 0     };
+        bool                    m_overflow { false };
+    };
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__PROTOBUF_ACCEPTOR__H */
@@ -0,0 +1,597 @@
+/**
+ * @file      segment_acceptor.h
+ *
+ * @brief     Contains the acceptor, which appends the binary records into the
+ *            memory-mapped segment files, and the reader, which tails them
+ *            from the other process
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__SEGMENT_ACCEPTOR__H
+#define INCLUDE__SEGMENT_ACCEPTOR__H
+
+/* the segment files are available only on the POSIX systems */
+#if __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+
+/* library parts */
+#include <tag_string.h>
+#include <binary_layout.h>
+
+/* STL */
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <atomic>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+/* POSIX */
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      detail component namespace
+     */
+    namespace detail {
+        /**
+         * @brief      Layout of the segment file. The segment starts with the
+         *             header `[u64 magic][u64 segment index][u64 capacity]
+         *             [u64 reserved]`, followed by the frames
+         *             `[u32 length][binary record]`, every frame is padded
+         *             to 4 bytes, so the length is aligned. The zero length
+         *             is the end of the written data, the ROLLOVER length
+         *             means the writer continues in the next segment
+         */
+        struct segment_layout {
+            static constexpr uint64_t MAGIC    { 0x31304745534c494dull }; /* "MILSEG01" */
+            static constexpr size_t   HEADER   { 4 * sizeof(uint64_t) };
+            static constexpr size_t   FRAME    { sizeof(uint32_t) };
+            static constexpr size_t   ALIGN    { sizeof(uint32_t) };
+            static constexpr size_t   PAGE     { 4096 };
+            static constexpr uint32_t ROLLOVER { 0xffffffffu };
+
+            /**
+             * @brief      Returns the size of the frame with the record
+             *
+             * @param      aRecord    Size of the record
+             */
+            static constexpr size_t frameSize(size_t aRecord) noexcept {
+                return (FRAME + aRecord + ALIGN - 1) & ~(ALIGN - 1);
+            }
+        };
+
+        static_assert(std::atomic<uint32_t>::is_always_lock_free && std::atomic<uint64_t>::is_always_lock_free,
+                      "The segment files need the lock-free atomics shared between the processes");
+
+        /**
+         * @brief      Returns the shared word of the mapped segment
+         *
+         * @tparam     T       Type of the word
+         *
+         * @param      aPos    Position of the word, aligned to it's size
+         */
+        template<typename T>
+        inline std::atomic<T> & segmentWord(unsigned char const * aPos) noexcept {
+            return *reinterpret_cast<std::atomic<T> *>(const_cast<unsigned char *>(aPos));
+        }
+
+        /**
+         * @brief      Returns the path of the segment file: the prefix
+         *             followed by the zero-padded segment index
+         *
+         * @param      aPrefix     Path prefix of the segments
+         * @param      aSegment    Index of the segment
+         */
+        inline std::string segmentPath(std::string const & aPrefix, uint64_t aSegment) {
+            char suffix[32];
+            std::snprintf(suffix, sizeof(suffix), ".%08llu.seg", static_cast<unsigned long long>(aSegment));
+            return aPrefix + suffix;
+        }
+    } /* end of namespace detail */
+
+    /**
+     * @brief      The acceptor, which appends every result as the
+     *             binary_acceptor record into the memory-mapped segment file.
+     *             The segment is mapped once with the full capacity, the file
+     *             grows by the preallocation steps, and the writer continues
+     *             in the next segment, when the current one is full. So the
+     *             record is encoded directly into the page cache, and the
+     *             system calls are done only per preallocation step and per
+     *             segment
+     *
+     * @note       The length of the frame is published last with the release
+     *             store, so the segment_reader from the other process sees
+     *             only the whole records. The segments are never overwritten:
+     *             open() fails, when the segment file already exists. When
+     *             the segment can't be created or grown, the acceptor is
+     *             marked as failed, and all the next records are dropped
+     *
+     * @note       The acceptor shall be used by the single thread
+     */
+    class segment_acceptor {
+    public:
+        static constexpr size_t DEFAULT_SEGMENT_SIZE { size_t{ 64 } << 20 };
+        static constexpr size_t DEFAULT_PREALLOCATE  { size_t{ 4 } << 20  };
+
+        segment_acceptor() noexcept = default;
+
+        segment_acceptor(segment_acceptor const &) = delete;
+        segment_acceptor & operator=(segment_acceptor const &) = delete;
+
+        ~segment_acceptor() {
+            this->close();
+        }
+
+        /**
+         * @brief      Creates the first segment and starts writing into it
+         *
+         * @param      aPrefix         Path prefix of the segment files
+         * @param      aFirstSegment   Index of the first segment, shall not
+         *                             exist yet
+         * @param      aSegmentSize    Capacity of every segment
+         * @param      aPreallocate    The file grows by this number of bytes
+         *
+         * @return     false, if the segment can't be created
+         */
+        bool open(std::string aPrefix, uint64_t aFirstSegment = 0,
+                  size_t aSegmentSize = DEFAULT_SEGMENT_SIZE, size_t aPreallocate = DEFAULT_PREALLOCATE) {
+            this->close();
+
+            m_prefix      = std::move(aPrefix);
+            m_capacity    = aSegmentSize & ~(detail::segment_layout::ALIGN - 1);
+            m_preallocate = aPreallocate;
+            m_failed      = m_capacity < detail::segment_layout::HEADER + 2 * detail::segment_layout::FRAME
+                            || !this->openSegment(aFirstSegment);
+            return !m_failed;
+        }
+
+        /**
+         * @brief      Seals the last segment with the rollover mark, so the
+         *             readers move on to the next segment, and unmaps it. The
+         *             next writer shall start from the segment() + 1
+         */
+        void close() noexcept {
+            if (nullptr != m_base) {
+                if (this->grow(this->position() + detail::segment_layout::FRAME)) {
+                    detail::segmentWord<uint32_t>(m_pos).store(detail::segment_layout::ROLLOVER, std::memory_order_release);
+                }
+                this->closeSegment();
+            }
+        }
+
+        /**
+         * @brief      Writes the record
+         *
+         * @param      aTag      Associated tag
+         * @param      aTuple    The result of the methods chain
+         */
+        template<typename ... T>
+        void operator()(char const * aTag, std::tuple<T...> const & aTuple) noexcept {
+            this->write(tagId(aTag), aTuple);
+        }
+
+        /**
+         * @brief      Writes the record with the compile-time tag
+         *
+         * @param      <pos>     The compile-time tag
+         * @param      aTuple    The result of the methods chain
+         */
+        template<char ... cs, typename ... T>
+        void operator()(tag_string<cs...>, std::tuple<T...> const & aTuple) noexcept {
+            this->write(tag_string<cs...>::id, aTuple);
+        }
+
+        /**
+         * @brief      Schedules the write back of the written data, or waits
+         *             for it, when aWait is true
+         *
+         * @return     false, if the msync failed
+         */
+        bool flush(bool aWait = false) noexcept {
+            return nullptr == m_base
+                || 0 == ::msync(m_base, size_t(m_pos - m_base), aWait ? MS_SYNC : MS_ASYNC);
+        }
+
+        /**
+         * @brief      Returns index of the current segment
+         */
+        uint64_t segment() const noexcept {
+            return m_segment;
+        }
+
+        /**
+         * @brief      Returns number of the bytes written into the current
+         *             segment, including the header
+         */
+        size_t position() const noexcept {
+            return size_t(m_pos - m_base);
+        }
+
+        /**
+         * @brief      Returns true, if the segment couldn't be created or
+         *             grown, or the record is bigger than the segment
+         */
+        bool failed() const noexcept {
+            return m_failed;
+        }
+    private:
+        /**
+         * @brief      Writes the whole frame
+         *
+         * @param      aTagId    Id of the tag
+         * @param      aTuple    The result of the methods chain
+         */
+        template<typename ... T>
+        void write(uint64_t aTagId, std::tuple<T...> const & aTuple) noexcept {
+            static_assert((detail::binary_traits<std::decay_t<T>>::SUPPORTED && ...),
+                          "segment_acceptor supports only arithmetic and enum values");
+
+            constexpr size_t RECORD { sizeof(uint64_t) + binary_size_v<std::tuple<T...>> };
+            constexpr size_t FRAME  { detail::segment_layout::frameSize(RECORD) };
+
+            if (FRAME > size_t(m_end - m_pos) && !this->reserve(FRAME)) {
+                return;
+            }
+
+            unsigned char * const record { m_pos + detail::segment_layout::FRAME };
+            detail::writeLittleEndian(record, aTagId);
+            detail::writeTuple(record + sizeof(uint64_t), aTuple, std::index_sequence_for<T...>{});
+            detail::segmentWord<uint32_t>(m_pos).store(static_cast<uint32_t>(RECORD), std::memory_order_release);
+            m_pos += FRAME;
+        }
+
+        /**
+         * @brief      Makes room for the frame: grows the file by the
+         *             preallocation step, or moves to the next segment, when
+         *             the current one is full. The room for the rollover mark
+         *             is always kept at the end of the segment
+         *
+         * @param      aFrame    Size of the frame
+         *
+         * @return     false, if the acceptor is failed
+         */
+        bool reserve(size_t aFrame) {
+            if (m_failed) {
+                return false;
+            }
+
+            size_t const position { size_t(m_pos - m_base) };
+            size_t const limit    { m_capacity - detail::segment_layout::FRAME };
+
+            if (position + aFrame > limit) {
+                if (!this->grow(position + detail::segment_layout::FRAME)) {
+                    return false;
+                }
+                detail::segmentWord<uint32_t>(m_pos).store(detail::segment_layout::ROLLOVER, std::memory_order_release);
+                this->closeSegment();
+
+                m_failed = !this->openSegment(m_segment + 1)
+                        || detail::segment_layout::HEADER + aFrame > limit;
+                return !m_failed && (aFrame <= size_t(m_end - m_pos) || this->grow(detail::segment_layout::HEADER + aFrame));
+            }
+
+            return this->grow(position + aFrame);
+        }
+
+        /**
+         * @brief      Grows the file at least up to aSize bytes, the end of
+         *             the room for the frames stays before the room of the
+         *             rollover mark
+         *
+         * @return     false, if the file can't be grown, or aSize exceeds
+         *             the capacity of the segment
+         */
+        bool grow(size_t aSize) noexcept {
+            size_t const current { m_size };
+            if (aSize <= current) {
+                return true;
+            }
+            if (aSize > m_capacity) {
+                m_failed = true;
+                return false;
+            }
+
+            size_t size { current + m_preallocate };
+            size = size < aSize ? aSize : size;
+            size = (size + detail::segment_layout::PAGE - 1) & ~(detail::segment_layout::PAGE - 1);
+            size = size < m_capacity ? size : m_capacity;
+
+#if defined(__linux__)
+            bool const grown { 0 == ::posix_fallocate(m_fd, 0, static_cast<off_t>(size)) };
+#else
+            bool const grown { 0 == ::ftruncate(m_fd, static_cast<off_t>(size)) };
+#endif
+            if (!grown) {
+                m_failed = true;
+                return false;
+            }
+
+#if defined(MADV_POPULATE_WRITE)
+            /* the pages are faulted in per step, not per record, the failure is harmless */
+            ::madvise(m_base + current, size - current, MADV_POPULATE_WRITE);
+#endif
+            size_t const limit { m_capacity - detail::segment_layout::FRAME };
+
+            m_size = size;
+            m_end  = m_base + (size < limit ? size : limit);
+            return true;
+        }
+
+        /**
+         * @brief      Creates and maps the segment, writes it's header
+         *
+         * @param      aSegment    Index of the segment
+         */
+        bool openSegment(uint64_t aSegment) {
+            m_segment = aSegment;
+            m_fd      = ::open(detail::segmentPath(m_prefix, aSegment).c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+            if (m_fd < 0) {
+                return false;
+            }
+
+            void * const base { ::mmap(nullptr, m_capacity, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0) };
+            if (MAP_FAILED == base) {
+                ::close(m_fd);
+                m_fd = -1;
+                return false;
+            }
+
+            m_base = static_cast<unsigned char *>(base);
+            m_pos  = m_base + detail::segment_layout::HEADER;
+            m_end  = m_base;
+            m_size = 0;
+            if (!this->grow(detail::segment_layout::HEADER + detail::segment_layout::FRAME)) {
+                this->closeSegment();
+                return false;
+            }
+
+            detail::writeLittleEndian(m_base + sizeof(uint64_t), aSegment);
+            detail::writeLittleEndian(m_base + 2 * sizeof(uint64_t), static_cast<uint64_t>(m_capacity));
+            detail::segmentWord<uint64_t>(m_base).store(detail::segment_layout::MAGIC, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief      Unmaps and closes the current segment
+         */
+        void closeSegment() noexcept {
+            ::munmap(m_base, m_capacity);
+            ::close(m_fd);
+            m_fd   = -1;
+            m_base = nullptr;
+            m_pos  = nullptr;
+            m_end  = nullptr;
+            m_size = 0;
+        }
+
+        std::string       m_prefix;
+        size_t            m_capacity    { 0 };
+        size_t            m_preallocate { 0 };
+        uint64_t          m_segment     { 0 };
+        int               m_fd          { -1 };
+        unsigned char *   m_base        { nullptr };
+        unsigned char *   m_pos         { nullptr };
+        unsigned char *   m_end         { nullptr };
+        size_t            m_size        { 0 };
+        bool              m_failed      { false };
+    };
+
+    /**
+     * @brief      The record read from the segment: the binary_acceptor
+     *             record `[u64 tag id][tuple elements]`, which may be passed
+     *             into object_apply as is
+     */
+    struct segment_record {
+        unsigned char const *   data { nullptr };
+        size_t                  size { 0 };
+
+        /**
+         * @brief      Returns id of the tag of the record
+         */
+        uint64_t id() const noexcept {
+            return detail::readLittleEndian<uint64_t>(data);
+        }
+    };
+
+    /**
+     * @brief      The reader of the segment files written by the
+     *             segment_acceptor, may run in the other process at the same
+     *             time with the writer. The segments are mapped read-only and
+     *             the records are returned in place, without copies
+     *
+     * @note       The record stays valid until the reader moves to the next
+     *             segment or is closed
+     */
+    class segment_reader {
+    public:
+        segment_reader() noexcept = default;
+
+        segment_reader(segment_reader const &) = delete;
+        segment_reader & operator=(segment_reader const &) = delete;
+
+        ~segment_reader() {
+            this->close();
+        }
+
+        /**
+         * @brief      Starts reading from the beginning of the segment. The
+         *             segment may not exist yet, it's opened, when the writer
+         *             creates it
+         *
+         * @param      aPrefix         Path prefix of the segment files
+         * @param      aFirstSegment   Index of the first segment
+         */
+        void open(std::string aPrefix, uint64_t aFirstSegment = 0) {
+            this->close();
+
+            m_prefix  = std::move(aPrefix);
+            m_segment = aFirstSegment;
+            m_failed  = false;
+        }
+
+        /**
+         * @brief      Unmaps the current segment
+         */
+        void close() noexcept {
+            if (nullptr != m_base) {
+                ::munmap(const_cast<unsigned char *>(m_base), m_capacity);
+                m_base = nullptr;
+            }
+            if (m_fd >= 0) {
+                ::close(m_fd);
+                m_fd = -1;
+            }
+        }
+
+        /**
+         * @brief      Reads the next record
+         *
+         * @param      aRecord    The record
+         *
+         * @return     false, if no whole record is written yet
+         */
+        bool next(segment_record & aRecord) {
+            while (!m_failed && (nullptr != m_base || this->openSegment())) {
+                if (m_pos + detail::segment_layout::FRAME > m_size && !this->refresh(m_pos + detail::segment_layout::FRAME)) {
+                    return false;
+                }
+
+                uint32_t const length { detail::segmentWord<uint32_t>(m_base + m_pos).load(std::memory_order_acquire) };
+                if (0 == length) {
+                    return false;
+                }
+
+                if (detail::segment_layout::ROLLOVER == length) {
+                    this->close();
+                    ++m_segment;
+                    continue;
+                }
+
+                size_t const frame { detail::segment_layout::frameSize(length) };
+                if (length < sizeof(uint64_t) || m_pos + frame > m_capacity) {
+                    m_failed = true;
+                    return false;
+                }
+
+                aRecord = segment_record{ m_base + m_pos + detail::segment_layout::FRAME, length };
+                m_pos  += frame;
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief      Returns index of the current segment
+         */
+        uint64_t segment() const noexcept {
+            return m_segment;
+        }
+
+        /**
+         * @brief      Returns true, if the segment is corrupted
+         */
+        bool failed() const noexcept {
+            return m_failed;
+        }
+    private:
+        /**
+         * @brief      Opens and maps the current segment, when the writer has
+         *             created it and written it's header
+         *
+         * @return     false, if the segment is not ready yet
+         */
+        bool openSegment() {
+            if (m_fd < 0) {
+                m_fd = ::open(detail::segmentPath(m_prefix, m_segment).c_str(), O_RDONLY | O_CLOEXEC);
+                if (m_fd < 0) {
+                    return false;
+                }
+            }
+
+            unsigned char header[detail::segment_layout::HEADER];
+            if (ssize_t(sizeof(header)) != ::pread(m_fd, header, sizeof(header), 0)) {
+                return false;
+            }
+
+            uint64_t const magic { detail::readLittleEndian<uint64_t>(header) };
+            if (0 == magic) {
+                return false;
+            }
+
+            m_capacity = static_cast<size_t>(detail::readLittleEndian<uint64_t>(header + 2 * sizeof(uint64_t)));
+            if (detail::segment_layout::MAGIC != magic
+                || m_segment != detail::readLittleEndian<uint64_t>(header + sizeof(uint64_t))
+                || m_capacity < detail::segment_layout::HEADER + detail::segment_layout::FRAME) {
+                m_failed = true;
+                return false;
+            }
+
+            void * const base { ::mmap(nullptr, m_capacity, PROT_READ, MAP_SHARED, m_fd, 0) };
+            if (MAP_FAILED == base) {
+                m_failed = true;
+                return false;
+            }
+
+            m_base = static_cast<unsigned char const *>(base);
+            m_pos  = detail::segment_layout::HEADER;
+            m_size = 0;
+            return true;
+        }
+
+        /**
+         * @brief      Updates the known size of the file, the mapped pages
+         *             beyond the end of the file shall not be touched
+         *
+         * @param      aSize    The size needed
+         *
+         * @return     false, if the file is still smaller
+         */
+        bool refresh(size_t aSize) noexcept {
+            struct stat status;
+            if (0 != ::fstat(m_fd, &status)) {
+                return false;
+            }
+            m_size = static_cast<size_t>(status.st_size);
+            return aSize <= m_size;
+        }
+
+        std::string             m_prefix;
+        uint64_t                m_segment  { 0 };
+        int                     m_fd       { -1 };
+        unsigned char const *   m_base     { nullptr };
+        size_t                  m_capacity { 0 };
+        size_t                  m_size     { 0 };
+        size_t                  m_pos      { 0 };
+        bool                    m_failed   { false };
+    };
+} /* end of namespace mil */
+
+#endif /* end of #if __has_include(<sys/mman.h>) && __has_include(<unistd.h>) */
+
+#endif /* end of #ifndef INCLUDE__SEGMENT_ACCEPTOR__H */
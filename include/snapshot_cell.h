@@ -0,0 +1,164 @@
+/**
+ * @file      snapshot_cell.h
+ *
+ * @brief     Contains the cell, which publishes the flat snapshots of the
+ *            single writer to any number of the readers by the seqlock,
+ *            without the locks and the allocations
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__SNAPSHOT_CELL__H
+#define INCLUDE__SNAPSHOT_CELL__H
+
+/* library parts */
+#include <object_schema.h>
+#include <flat_acceptor.h>
+
+/* STL */
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <type_traits>
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      The cell, which holds the last flat snapshot of the object.
+     *             The writer invokes the object into the own staging buffer,
+     *             then publishes it under the sequence counter (the seqlock),
+     *             so the writer never waits for the readers. The readers copy
+     *             the snapshot and retry, if the writer published the next
+     *             one meanwhile, so every copy is the whole single snapshot
+     *
+     * @note       There shall be the single writer. The snapshot is kept as
+     *             the atomic words, so the racing copies are well-defined and
+     *             cost the plain loads and stores. The copy is read by
+     *             flat_view, the cell reads as the invalid snapshot until the
+     *             first publish. The cell never allocates
+     *
+     * @tparam     Size    Size of the flat snapshot, `object_schema::flatSize`
+     */
+    template<size_t Size>
+    class snapshot_cell {
+    public:
+        static constexpr size_t WORDS { (Size + sizeof(uint64_t) - 1) / sizeof(uint64_t) };
+
+        /**
+         * @brief      The copy of the snapshot
+         */
+        using snapshot_t = std::array<uint64_t, WORDS>;
+
+        /**
+         * @brief      Invokes the object into the flat snapshot and publishes
+         *             it, shall be called by the writer only
+         *
+         * @param      aInvoke    The invoke with the flat acceptor
+         * @param      aObj       The object
+         * @param      aSchema    Schema of the invoke
+         *
+         * @return     false, if the snapshot of the schema doesn't fit the
+         *             cell, the published snapshot stays the same then
+         */
+        template<typename TInvoke, typename TObj, size_t N>
+        bool publish(TInvoke const & aInvoke, TObj & aObj, object_schema<N> const & aSchema) noexcept {
+            static_assert(std::is_same_v<typename TInvoke::acceptor_t, flat_acceptor>,
+                          "snapshot_cell publishes the invokes with the flat_acceptor");
+
+            flat_acceptor acceptor { m_staging.data(), sizeof(m_staging) };
+            if (!acceptor.begin(aSchema)) {
+                return false;
+            }
+            aInvoke(aObj, acceptor);
+            acceptor.end();
+
+            uint64_t const sequence { m_sequence.load(std::memory_order_relaxed) };
+            m_sequence.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            for (size_t i { 0 }; i < WORDS; ++i) {
+                uint64_t word;
+                std::memcpy(&word, m_staging.data() + sizeof(uint64_t) * i, sizeof(word));
+                m_words[i].store(word, std::memory_order_relaxed);
+            }
+            m_sequence.store(sequence + 2, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief      Copies the published snapshot, safe to call from any
+         *             thread
+         *
+         * @param      aSnapshot    The copy
+         *
+         * @return     Version of the copied snapshot, zero if nothing is
+         *             published yet, or if the writer was publishing the
+         *             next snapshot meanwhile (the copy is torn then)
+         */
+        uint64_t tryLoad(snapshot_t & aSnapshot) const noexcept {
+            uint64_t const before { m_sequence.load(std::memory_order_acquire) };
+            if (0 != (before & 1u)) {
+                return 0;
+            }
+            for (size_t i { 0 }; i < WORDS; ++i) {
+                aSnapshot[i] = m_words[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return m_sequence.load(std::memory_order_relaxed) == before ? before / 2 : 0;
+        }
+
+        /**
+         * @brief      Same as above, but retries until the copy is the whole
+         *             snapshot, yields to the writer between the retries
+         *
+         * @return     Version of the copied snapshot, zero if nothing is
+         *             published yet
+         */
+        uint64_t load(snapshot_t & aSnapshot) const noexcept {
+            for (;;) {
+                uint64_t const version { this->tryLoad(aSnapshot) };
+                if (0 != version || 0 == this->version()) {
+                    return version;
+                }
+                std::this_thread::yield();
+            }
+        }
+
+        /**
+         * @brief      Returns version of the last published snapshot, so the
+         *             readers may skip the copy of the same one
+         */
+        uint64_t version() const noexcept {
+            return m_sequence.load(std::memory_order_acquire) / 2;
+        }
+    private:
+        using staging_t = std::array<unsigned char, WORDS * sizeof(uint64_t)>;
+
+        alignas(64) std::atomic<uint64_t>                      m_sequence { 0 };
+        alignas(64) std::array<std::atomic<uint64_t>, WORDS>   m_words    { };
+        alignas(64) staging_t                                  m_staging  { };
+    };
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__SNAPSHOT_CELL__H */
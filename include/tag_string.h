@@ -0,0 +1,194 @@
+/**
+ * @file      tag_string.h
+ *
+ * @brief     Contains the compile-time tags, which carry the tag name and it's
+ *            integer id in the type
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__TAG_STRING__H
+#define INCLUDE__TAG_STRING__H
+
+/* STL */
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <type_traits>
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      Returns id of the tag, FNV-1a hash of the tag name. The same
+     *             function is used for the compile-time tags, so the ids of
+     *             the runtime and compile-time tags are the same
+     *
+     * @param      aTag    The tag name, null-terminated
+     *
+     * @return     The tag id
+     */
+    constexpr inline uint64_t tagId(char const * aTag) noexcept {
+        uint64_t hash { 0xcbf29ce484222325ull };
+        for (; *aTag; ++aTag) {
+            hash ^= static_cast<unsigned char>(*aTag);
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+    /**
+     * @brief      The compile-time tag. Empty type, which holds the tag name
+     *             and the tag id, so the acceptors are able to key on the
+     *             integer id without any string handling
+     *
+     * @note       Converts to `char const *`, so the acceptors accepting the
+     *             runtime tags work with the compile-time tags as well
+     *
+     * @tparam     cs    Characters of the tag name
+     */
+    template<char ... cs>
+    struct tag_string {
+        static constexpr char     name[] { cs..., '\0'  };
+        static constexpr size_t   length { sizeof...(cs) };
+        static constexpr uint64_t id     { tagId(name)   };
+
+        /**
+         * @brief      Returns the tag name
+         */
+        constexpr operator char const *() const noexcept {
+            return name;
+        }
+    };
+
+/** @{ */
+/* is_tag_string meta-function */
+    /**
+     * @brief      Initial definition, the type isn't compile-time tag
+     *
+     * @tparam     T    Type to check
+     */
+    template<typename T>
+    struct is_tag_string : std::false_type {};
+
+    /**
+     * @brief      Overload for the compile-time tags
+     *
+     * @tparam     cs    Characters of the tag name
+     */
+    template<char ... cs>
+    struct is_tag_string<tag_string<cs...>> : std::true_type {};
+
+    /**
+     * @brief      stl's _v standalone value
+     *
+     * @tparam     T    Type to check
+     */
+    template<typename T>
+    constexpr bool is_tag_string_v = is_tag_string<T>::value;
+/** @} */
+
+    /**
+     * @brief      User-defined literals of the library
+     */
+    namespace literals {
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+        /**
+         * @brief      Makes the compile-time tag, `"name"_tag`
+         *
+         * @note       The string literal operator template is the GCC/Clang
+         *             extension, `mil::tag_string<'n', 'a', 'm', 'e'>` can be
+         *             used directly with other compilers
+         *
+         * @tparam     CharT    Type of the characters
+         * @tparam     cs       Characters of the tag name
+         */
+        template<typename CharT, CharT ... cs>
+        constexpr tag_string<cs...> operator""_tag() noexcept {
+            static_assert(std::is_same_v<CharT, char>, "Only narrow string tags are supported");
+            return {};
+        }
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+    } /* end of namespace literals */
+
+    /**
+     * @brief      detail component namespace
+     */
+    namespace detail {
+        /**
+         * @brief      Sifts the id down the max-heap
+         *
+         * @param      aIds     Pointer to the ids
+         * @param      aRoot    Index of the id to sift
+         * @param      aEnd     Size of the heap
+         */
+        constexpr inline void siftTagId(uint64_t * aIds, size_t aRoot, size_t aEnd) noexcept {
+            for (size_t child { 2 * aRoot + 1 }; child < aEnd; aRoot = child, child = 2 * aRoot + 1) {
+                if (child + 1 < aEnd && aIds[child] < aIds[child + 1]) {
+                    ++child;
+                }
+                if (!(aIds[aRoot] < aIds[child])) {
+                    return;
+                }
+                uint64_t const id { aIds[aRoot] };
+                aIds[aRoot] = aIds[child];
+                aIds[child] = id;
+            }
+        }
+
+        /**
+         * @brief      Checks, that all the ids are unique: sorts the ids by
+         *             the heapsort (std::sort is constexpr since C++20 only)
+         *             and compares the adjacent ones, so the check costs
+         *             O(N log N) constexpr operations for N tags
+         *
+         * @param      aIds      The ids, sorted in place of the copy
+         * @param      aCount    Number of the ids
+         *
+         * @return     true, if there are no collisions
+         */
+        template<size_t N>
+        constexpr bool uniqueTagIds(std::array<uint64_t, N> aIds, size_t aCount) noexcept {
+            for (size_t i { aCount / 2 }; i > 0; --i) {
+                siftTagId(aIds.data(), i - 1, aCount);
+            }
+            for (size_t end { aCount }; end > 1; --end) {
+                uint64_t const id { aIds[0] };
+                aIds[0]       = aIds[end - 1];
+                aIds[end - 1] = id;
+                siftTagId(aIds.data(), 0, end - 1);
+            }
+            for (size_t i { 1 }; i < aCount; ++i) {
+                if (aIds[i - 1] == aIds[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    } /* end of namespace detail */
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__TAG_STRING__H */
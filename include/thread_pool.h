@@ -0,0 +1,254 @@
+/**
+ * @file      thread_pool.h
+ *
+ * @brief     Contains the small work-stealing thread pool, used by the
+ *            parallel invokers
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__THREAD_POOL__H
+#define INCLUDE__THREAD_POOL__H
+
+/* STL */
+#include <cstddef>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <type_traits>
+#include <condition_variable>
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      The work-stealing thread pool. Runs the indexed chunks of
+     *             the single job: every worker gets the contiguous range of
+     *             the chunks, takes them from the front, and when the own
+     *             range is exhausted steals from the back of the others
+     *
+     * @note       The calling thread takes part in every job as the worker
+     *             number 0, so the pool of the single thread has no threads
+     *
+     * @note       The exception thrown by the chunk is caught by the worker,
+     *             the rest chunks of the job are skipped, and the first
+     *             exception is rethrown by run() after all the workers left
+     *             the job, so the job never outlives the caller's frame
+     */
+    class thread_pool {
+    public:
+        /**
+         * @brief      Creates the thread pool
+         *
+         * @param      aThreads    Number of workers, including the caller
+         */
+        explicit thread_pool(size_t aThreads)
+            : m_queues ( aThreads ? aThreads : 1 )
+        {
+            m_threads.reserve(m_queues.size() - 1);
+            for (size_t worker { 1 }; worker < m_queues.size(); ++worker) {
+                m_threads.emplace_back([this, worker] { this->workerLoop(worker); });
+            }
+        }
+
+        thread_pool(thread_pool const &) = delete;
+        thread_pool & operator=(thread_pool const &) = delete;
+
+        /**
+         * @brief      Stops and joins all the workers
+         */
+        ~thread_pool() {
+            {
+                std::lock_guard<std::mutex> lock { m_mutex };
+                m_stop = true;
+            }
+            m_wakeUp.notify_all();
+            for (auto & thread: m_threads) {
+                thread.join();
+            }
+        }
+
+        /**
+         * @brief      Returns number of the workers, including the caller
+         */
+        size_t size() const noexcept {
+            return m_queues.size();
+        }
+
+        /**
+         * @brief      Runs the job and waits until all it's chunks are done,
+         *             rethrows the first exception thrown by the chunks
+         *
+         * @tparam     TFn       Type of the job
+         *
+         * @param      aChunks   Number of the chunks
+         * @param      aFn       The job, invoked as `aFn(worker, chunk)`
+         */
+        template<typename TFn>
+        void run(size_t aChunks, TFn && aFn) {
+            if (0 == aChunks) {
+                return;
+            }
+
+            size_t const workers { m_queues.size() };
+            for (size_t worker { 0 }; worker < workers; ++worker) {
+                m_queues[worker].m_begin = aChunks * worker / workers;
+                m_queues[worker].m_end   = aChunks * (worker + 1) / workers;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock { m_mutex };
+                m_job       = &invokeJob<std::remove_reference_t<TFn>>;
+                m_context   = std::addressof(aFn);
+                m_busy      = workers - 1;
+                m_failed.store(false, std::memory_order_relaxed);
+                ++m_generation;
+            }
+            m_wakeUp.notify_all();
+
+            this->work(0);
+
+            std::unique_lock<std::mutex> lock { m_mutex };
+            m_done.wait(lock, [this] { return 0 == m_busy; });
+            if (m_error) {
+                std::exception_ptr const error { std::exchange(m_error, nullptr) };
+                lock.unlock();
+                std::rethrow_exception(error);
+            }
+        }
+    private:
+        using job_ptr_t = void(*)(void *, size_t, size_t);
+
+        /**
+         * @brief      The chunks range of the single worker
+         */
+        struct alignas(64) queue {
+            std::mutex m_mutex { };
+            size_t     m_begin { 0 };
+            size_t     m_end   { 0 };
+        };
+
+        /**
+         * @brief      Type-erased job invoker
+         */
+        template<typename TFn>
+        static void invokeJob(void * aContext, size_t aWorker, size_t aChunk) {
+            (*static_cast<TFn *>(aContext))(aWorker, aChunk);
+        }
+
+        /**
+         * @brief      Takes the next chunk from the front of the own queue
+         */
+        bool popOwn(size_t aWorker, size_t & aChunk) {
+            auto & own { m_queues[aWorker] };
+            std::lock_guard<std::mutex> lock { own.m_mutex };
+            if (own.m_begin < own.m_end) {
+                aChunk = own.m_begin++;
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief      Steals the chunk from the back of any other queue
+         */
+        bool steal(size_t aWorker, size_t & aChunk) {
+            size_t const workers { m_queues.size() };
+            for (size_t shift { 1 }; shift < workers; ++shift) {
+                auto & victim { m_queues[(aWorker + shift) % workers] };
+                std::lock_guard<std::mutex> lock { victim.m_mutex };
+                if (victim.m_begin < victim.m_end) {
+                    aChunk = --victim.m_end;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief      Processes the chunks until there are no more of them, or
+         *             until any chunk throws
+         */
+        void work(size_t aWorker) noexcept {
+            size_t chunk { 0 };
+            while (!m_failed.load(std::memory_order_relaxed) && (popOwn(aWorker, chunk) || steal(aWorker, chunk))) {
+#if defined(__cpp_exceptions)
+                try {
+                    (*m_job)(m_context, aWorker, chunk);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock { m_mutex };
+                    if (!m_error) {
+                        m_error = std::current_exception();
+                    }
+                    m_failed.store(true, std::memory_order_relaxed);
+                }
+#else
+                (*m_job)(m_context, aWorker, chunk);
+#endif
+            }
+        }
+
+        /**
+         * @brief      Main loop of the worker thread
+         */
+        void workerLoop(size_t aWorker) {
+            size_t generation { 0 };
+            for (;;) {
+                {
+                    std::unique_lock<std::mutex> lock { m_mutex };
+                    m_wakeUp.wait(lock, [&] { return m_stop || generation != m_generation; });
+                    if (m_stop) {
+                        return;
+                    }
+                    generation = m_generation;
+                }
+
+                this->work(aWorker);
+
+                std::lock_guard<std::mutex> lock { m_mutex };
+                if (0 == --m_busy) {
+                    m_done.notify_one();
+                }
+            }
+        }
+
+        std::vector<queue>       m_queues;
+        std::vector<std::thread> m_threads    { };
+
+        std::mutex               m_mutex      { };
+        std::condition_variable  m_wakeUp     { };
+        std::condition_variable  m_done       { };
+        bool                     m_stop       { false };
+        size_t                   m_generation { 0 };
+        size_t                   m_busy       { 0 };
+
+        job_ptr_t                m_job        { nullptr };
+        void *                   m_context    { nullptr };
+        std::atomic<bool>        m_failed     { false   };
+        std::exception_ptr       m_error      { };
+    };
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__THREAD_POOL__H */
@@ -0,0 +1,322 @@
+/**
+ * @file      trie_object_invoke.h
+ *
+ * @brief     Contains the object invoke flavor, which merges all the methods
+ *            chains into the compile-time prefix trie, so every common
+ *            prefix of the chains is invoked only once per call
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__TRIE_OBJECT_INVOKE__H
+#define INCLUDE__TRIE_OBJECT_INVOKE__H
+
+/* library parts */
+#include <chain_invoke.h>
+#include <object_invoke.h>
+#include <metaprogramming_base.h>
+#include <version_stamp.h>
+#include <field_mask.h>
+
+/* STL */
+#include <cstddef>
+#include <algorithm>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      detail component namespace
+     */
+    namespace detail {
+        /**
+         * @brief      The leaf of the trie: index of the invoker and the rest
+         *             of it's methods chain, which is not invoked yet
+         *
+         * @tparam     Idx      Index of the invoker
+         * @tparam     Chain    values_list with the rest of the chain
+         */
+        template<size_t Idx, typename Chain>
+        struct trie_leaf {};
+
+    /** @{ */
+    /* trie_leaf_match meta-function, which splits leaves by the first method */
+        /**
+         * @brief      Initial definition, used for the leaves, which chain is
+         *             already finished, such leaves never match
+         *
+         * @tparam     Head    values_list with the method to match
+         * @tparam     Leaf    The leaf
+         */
+        template<typename Head, typename Leaf>
+        struct trie_leaf_match {
+            using same  = types_list<>;
+            using other = types_list<Leaf>;
+        };
+
+        /**
+         * @brief      Overload for the leaves with not finished chain, the
+         *             matched leaf is passed further without the first method
+         *
+         * @tparam     Head    values_list with the method to match
+         * @tparam     Idx     Index of the invoker
+         * @tparam     f       The first method of the chain
+         * @tparam     rest    The rest methods of the chain
+         */
+        template<typename Head, size_t Idx, auto f, auto ... rest>
+        struct trie_leaf_match<Head, trie_leaf<Idx, values_list<f, rest...>>> {
+            static constexpr bool MATCH { std::is_same_v<Head, values_list<f>> };
+
+            using same  = std::conditional_t<MATCH, types_list<trie_leaf<Idx, values_list<rest...>>>, types_list<>>;
+            using other = std::conditional_t<MATCH, types_list<>, types_list<trie_leaf<Idx, values_list<f, rest...>>>>;
+        };
+    /** @} */
+
+        /**
+         * @brief      Splits the leaves into the ones starting with the Head
+         *             method (with the Head method removed) and all the
+         *             others, the order of the leaves is preserved
+         *
+         * @tparam     Head      values_list with the method to match
+         * @tparam     Leaves    The leaves
+         */
+        template<typename Head, typename ... Leaves>
+        struct trie_partition {
+            using same  = concat_t<typename trie_leaf_match<Head, Leaves>::same...>;
+            using other = concat_t<typename trie_leaf_match<Head, Leaves>::other...>;
+        };
+
+        /**
+         * @brief      Versions policy of the plain trie invoke, nothing is
+         *             skipped
+         */
+        struct no_versions {
+            template<size_t Idx, size_t Position, typename TObj>
+            static constexpr bool unchanged(TObj const &) noexcept {
+                return false;
+            }
+
+            template<size_t Idx>
+            static constexpr void emitted() noexcept {}
+        };
+
+        /**
+         * @brief      Versions policy of the versioned trie invoke: every edge
+         *             of the trie has the own stamp slot, identified by the
+         *             first leaf passing through the edge and the position of
+         *             the method in it's chain
+         *
+         * @tparam     N        Number of the invokers
+         * @tparam     Depth    Length of the longest chain
+         */
+        template<size_t N, size_t Depth>
+        struct trie_versions {
+            version_state<N * Depth> &   state;
+            field_mask<N>                invoked { };
+
+            /**
+             * @brief      Returns true, if the object has the same stamp as
+             *             the last time this edge was passed
+             */
+            template<size_t Idx, size_t Position, typename TObj>
+            constexpr bool unchanged(TObj const & aObj) noexcept {
+                return state.unchanged(Idx * Depth + Position, aObj);
+            }
+
+            /**
+             * @brief      Marks the invoker as emitted
+             */
+            template<size_t Idx>
+            constexpr void emitted() noexcept {
+                invoked.set(Idx);
+            }
+        };
+
+    /** @{ */
+    /* trieObject function, which returns object for the next method of the trie */
+        /**
+         * @brief      Returns the object for the root of the trie
+         *
+         * @tparam     Cl    Class of the next method
+         * @tparam     T     Type of the object
+         */
+        template<typename Cl, typename T>
+        constexpr Cl & trieObject(FoldingBeginner<T> & aNode) {
+            return aNode.obj;
+        }
+
+        /**
+         * @brief      Returns the object for the intermediate node of the trie
+         *
+         * @tparam     Cl    Class of the next method
+         * @tparam     Fx    Method of the node
+         */
+        template<typename Cl, typename Fx>
+        constexpr decltype(auto) trieObject(OwningInvokingStep<Fx> & aNode) {
+            return stepObject<Cl>(aNode.tuple);
+        }
+    /** @} */
+
+    /** @{ */
+    /* trieInvoke function, which walks through the trie */
+        /**
+         * @brief      No more leaves for the node
+         */
+        template<typename Node, typename TInvokers, typename TResultAcceptor, typename TVersions>
+        constexpr void trieInvoke(types_list<>, Node &, TInvokers const &, TResultAcceptor &, TVersions &) {}
+
+        /**
+         * @brief      The chain of the first leaf is finished in this node, so
+         *             the node result is passed into the acceptor
+         *
+         * @tparam     Idx       Index of the invoker
+         * @tparam     Leaves    The rest leaves of the node
+         */
+        template<size_t Idx, typename ... Leaves, typename Node, typename TInvokers, typename TResultAcceptor, typename TVersions>
+        constexpr void trieInvoke(types_list<trie_leaf<Idx, values_list<>>, Leaves...>, Node & aNode,
+                                  TInvokers const & aInvokers, TResultAcceptor & aAcceptor, TVersions & aVersions) {
+            aAcceptor(get<Idx>(aInvokers).tag(), std::as_const(aNode.tuple));
+            aVersions.template emitted<Idx>();
+            trieInvoke(types_list<Leaves...>{}, aNode, aInvokers, aAcceptor, aVersions);
+        }
+
+        /**
+         * @brief      The chain of the first leaf continues, so the next
+         *             method is invoked only once for all the leaves sharing
+         *             it, and the walk continues for the child node. The
+         *             whole subtree is skipped, when the versions policy
+         *             reports the object unchanged
+         *
+         * @tparam     Idx       Index of the invoker
+         * @tparam     f         The next method of the first leaf
+         * @tparam     rest      The rest methods of the first leaf
+         * @tparam     Leaves    The rest leaves of the node
+         */
+        template<size_t Idx, auto f, auto ... rest, typename ... Leaves, typename Node, typename TInvokers,
+                 typename TResultAcceptor, typename TVersions>
+        constexpr void trieInvoke(types_list<trie_leaf<Idx, values_list<f, rest...>>, Leaves...>, Node & aNode,
+                                  TInvokers const & aInvokers, TResultAcceptor & aAcceptor, TVersions & aVersions) {
+            using fx_t        = decltype(f);
+            using partition_t = trie_partition<values_list<f>, trie_leaf<Idx, values_list<f, rest...>>, Leaves...>;
+
+            constexpr size_t POSITION { flat_tuple_element_t<Idx, TInvokers>::chain_t::SIZE - 1 - sizeof...(rest) };
+
+            auto & object { trieObject<typename function_info<fx_t>::cl>(aNode) };
+            if (!aVersions.template unchanged<Idx, POSITION>(object)) {
+                OwningInvokingStep<fx_t> child { std::integral_constant<fx_t, f>{}, object };
+                trieInvoke(typename partition_t::same{}, child, aInvokers, aAcceptor, aVersions);
+            }
+            trieInvoke(typename partition_t::other{}, aNode, aInvokers, aAcceptor, aVersions);
+        }
+    /** @} */
+
+        /**
+         * @brief      Makes the root leaves of the trie
+         *
+         * @tparam     TForwarders    Types of the delayed invoke forwarders
+         * @tparam     Idx            Indexes of the forwarders
+         */
+        template<typename ... TForwarders, size_t ... Idx>
+        constexpr auto trieLeaves(std::index_sequence<Idx...>) {
+            return types_list<trie_leaf<Idx, typename TForwarders::chain_t>...>{};
+        }
+    } /* end of namespace detail */
+
+    /**
+     * @brief      The object invoke, which merges all the chains into the
+     *             compile-time prefix trie. Every intermediate object is
+     *             built once and all the leaves under it are emitted from it
+     *
+     * @note       Results are passed into the acceptor grouped by the common
+     *             prefix: leaves are visited depth-first, children in the
+     *             order of their first registration. The identical chains
+     *             are invoked only once as well, so all of them get the
+     *             same result
+     *
+     * @tparam     TResultAcceptor    Callable object, which invoked with the
+     *                                tag and the result of the function
+     * @tparam     TForwarders        Types of the delayed invoke forwarders
+     */
+    template<typename TResultAcceptor, typename ... TForwarders>
+    struct trie_object_invoke {
+    public:
+        using object_t   = detail::invokers_class_t<TForwarders...>;
+        using acceptor_t = TResultAcceptor;
+        using leaves_t   = decltype(detail::trieLeaves<TForwarders...>(std::index_sequence_for<TForwarders...>{}));
+
+        static constexpr size_t INVOKERS_COUNT { sizeof...(TForwarders) };
+        static constexpr size_t MAX_DEPTH      { std::max({ TForwarders::chain_t::SIZE... }) };
+
+        using version_state_t = version_state<INVOKERS_COUNT * MAX_DEPTH>;
+
+        /**
+         * @brief      Creates the trie object invoke object
+         *
+         * @param      aInvokers    The delayed invoke forwarders
+         */
+        explicit constexpr trie_object_invoke(acceptor<acceptor_t>, TForwarders const & ... aInvokers)
+            : m_invokers { aInvokers... }
+        {}
+
+        /**
+         * @brief      Invokes all the registered invokers and passes every
+         *             result into the acceptor
+         */
+        constexpr void operator()(object_t & aObj, acceptor_t & aAcceptor) const {
+            detail::FoldingBeginner<object_t> root     { aObj };
+            detail::no_versions               versions { };
+            detail::trieInvoke(leaves_t{}, root, m_invokers, aAcceptor, versions);
+        }
+
+        /**
+         * @brief      Versioned snapshot: the subtree of the trie is skipped,
+         *             when the object it starts from has the version stamp
+         *             (see has_version_stamp), and the stamp didn't change
+         *             since the last snapshot with the same state. None of
+         *             the getters of the subtree is invoked
+         *
+         * @param      aObj       The object
+         * @param      aAcceptor  The acceptor
+         * @param      aState     The version state of the object
+         *
+         * @return     Mask of the invokers, which results are passed into the
+         *             acceptor
+         */
+        field_mask<INVOKERS_COUNT> operator()(object_t & aObj, acceptor_t & aAcceptor, version_state_t & aState) const {
+            detail::FoldingBeginner<object_t>                  root     { aObj   };
+            detail::trie_versions<INVOKERS_COUNT, MAX_DEPTH>   versions { aState };
+            detail::trieInvoke(leaves_t{}, root, m_invokers, aAcceptor, versions);
+            return versions.invoked;
+        }
+    private:
+        flat_tuple<TForwarders...>   m_invokers;
+    };
+
+    /* class deduction guides */
+    template<typename TResultAcceptor, typename ... T>
+    explicit trie_object_invoke(acceptor<TResultAcceptor>, T ...) -> trie_object_invoke<TResultAcceptor, T...>;
+
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__TRIE_OBJECT_INVOKE__H */
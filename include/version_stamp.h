@@ -0,0 +1,200 @@
+/**
+ * @file      version_stamp.h
+ *
+ * @brief     Contains the version stamps support: the objects exposing the
+ *            modification counter let the invokers skip the chains going
+ *            through them, while the counter stays the same
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__VERSION_STAMP__H
+#define INCLUDE__VERSION_STAMP__H
+
+/* library parts */
+#include <chain_invoke.h>
+#include <field_mask.h>
+#include <function_info.h>
+#include <metaprogramming_base.h>
+
+/* STL */
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <utility>
+#include <type_traits>
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+/** @{ */
+/* has_version_stamp meta-function */
+    /**
+     * @brief      Initial definition, the type has no version stamp
+     *
+     * @tparam     T    Type of the object
+     */
+    template<typename T, typename = void>
+    struct has_version_stamp : std::false_type {};
+
+    /**
+     * @brief      Overload for the types with `uint64_t versionStamp(T const &)`
+     *             found by ADL. The stamp shall change on every modification
+     *             of the object or of any object reachable from it
+     *
+     * @tparam     T    Type of the object
+     */
+    template<typename T>
+    struct has_version_stamp<T, std::void_t<decltype(uint64_t{ versionStamp(std::declval<T const &>()) })>>
+        : std::true_type {};
+
+    /**
+     * @brief      stl's _v standalone value
+     *
+     * @tparam     T    Type of the object
+     */
+    template<typename T>
+    constexpr bool has_version_stamp_v = has_version_stamp<std::remove_cv_t<T>>::value;
+
+    /**
+     * @brief      true, if any object of the methods chain has the version
+     *             stamp
+     *
+     * @tparam     fx    The methods chain
+     */
+    template<auto ... fx>
+    constexpr bool chain_has_version_stamp_v = (has_version_stamp_v<typename function_info<decltype(fx)>::cl> || ...);
+/** @} */
+
+    /**
+     * @brief      detail component namespace
+     */
+    namespace detail {
+        /**
+         * @brief      Compares the stamp of the object with the last seen one
+         *             and remembers the new stamp
+         *
+         * @param      aObj      The object
+         * @param      aStamp    The last seen stamp
+         * @param      aKnown    true, if aStamp was set before
+         *
+         * @return     true, if the object has the stamp, and it's the same
+         */
+        template<typename T>
+        constexpr bool sameStamp(T const & aObj, uint64_t & aStamp, bool aKnown) noexcept {
+            if constexpr (has_version_stamp_v<T>) {
+                uint64_t const stamp { versionStamp(aObj) };
+                if (aKnown && aStamp == stamp) {
+                    return true;
+                }
+                aStamp = stamp;
+            } else {
+                (void)aObj;
+                (void)aStamp;
+                (void)aKnown;
+            }
+            return false;
+        }
+    } /* end of namespace detail */
+
+    /**
+     * @brief      The per-object state of the versioned snapshots: the last
+     *             seen stamps, kept in the single flat block
+     *
+     * @note       The state shall be used with the same object every time
+     *
+     * @tparam     N    Number of the stamp slots
+     */
+    template<size_t N>
+    struct version_state {
+        std::array<uint64_t, N>   stamps { };
+        field_mask<N>             known  { };
+
+        /**
+         * @brief      Compares the stamp of the object with the one seen last
+         *             time in the slot, and remembers the new stamp
+         *
+         * @param      aSlot    The slot
+         * @param      aObj     The object
+         *
+         * @return     true, if the object has the stamp, and it's the same
+         */
+        template<typename T>
+        constexpr bool unchanged(size_t aSlot, T const & aObj) noexcept {
+            if (detail::sameStamp(aObj, stamps[aSlot], known.test(aSlot))) {
+                return true;
+            }
+            known.set(aSlot);
+            return false;
+        }
+
+        /**
+         * @brief      Forgets all the stamps, so the next versioned snapshot
+         *             invokes everything
+         */
+        constexpr void reset() noexcept {
+            known.clear();
+        }
+    };
+
+    /**
+     * @brief      Invokes the chain and passes the result into the callback,
+     *             unless the first object of the chain exposing the version
+     *             stamp has the same stamp as the last time. In such case
+     *             none of the getters after it is invoked
+     *
+     * @note       Only the first stamped object is checked, the deeper ones
+     *             are expected to change together with it. The chains
+     *             without stamped objects are always invoked
+     *
+     * @tparam     f        The first method of the chain
+     * @tparam     rest     The rest methods of the chain
+     * @tparam     TObj     Type of the object
+     * @tparam     TFn      Type of the callback
+     *
+     * @param      aObj     The object
+     * @param      aStamp   The last seen stamp, updated by the call
+     * @param      aKnown   true, if aStamp was set before
+     * @param      aFn      The callback, invoked with the result tuple
+     *
+     * @return     true, if the callback is invoked
+     */
+    template<auto f, auto ... rest, typename TObj, typename TFn>
+    constexpr bool chainInvokeIfChanged(TObj & aObj, uint64_t & aStamp, bool aKnown, TFn && aFn) {
+        if constexpr (has_version_stamp_v<TObj>) {
+            if (detail::sameStamp(aObj, aStamp, aKnown)) {
+                return false;
+            }
+            chainInvokeWith<f, rest...>(aObj, std::forward<TFn>(aFn));
+            return true;
+        } else if constexpr (0 == sizeof...(rest)) {
+            chainInvokeWith<f>(aObj, std::forward<TFn>(aFn));
+            return true;
+        } else {
+            using next_t = typename function_info<first_t<decltype(rest)...>>::cl;
+
+            detail::OwningInvokingStep<decltype(f)> step { std::integral_constant<decltype(f), f>{}, aObj };
+            return chainInvokeIfChanged<rest...>(detail::stepObject<next_t>(step.tuple), aStamp, aKnown, std::forward<TFn>(aFn));
+        }
+    }
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__VERSION_STAMP__H */
@@ -0,0 +1,351 @@
+/**
+ * @file      workspace_object_invoke.h
+ *
+ * @brief     Contains the object invoke flavor, which owns the preallocated
+ *            workspace for all the intermediate tuples and reuses it across
+ *            the calls
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef INCLUDE__WORKSPACE_OBJECT_INVOKE__H
+#define INCLUDE__WORKSPACE_OBJECT_INVOKE__H
+
+/* library parts */
+#include <function_info.h>
+#include <chain_invoke.h>
+#include <object_invoke.h>
+#include <inline_object_invoke.h>
+#include <metaprogramming_base.h>
+
+/* STL */
+#include <cstddef>
+#include <tuple>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <type_traits>
+
+/**
+ * @brief      mil component namespace
+ *
+ * @note       MIL - Metaprogramming Invoking Library
+ */
+namespace mil {
+    /**
+     * @brief      detail component namespace
+     */
+    namespace detail {
+/** @{ */
+/* has_reset_intermediate meta-function */
+        /**
+         * @brief      Initial definition, there is no reset hook for the type
+         *
+         * @tparam     T    Type of the intermediate value
+         */
+        template<typename T, typename = void>
+        struct has_reset_intermediate : std::false_type {};
+
+        /**
+         * @brief      Overload for the types with `resetIntermediate(T &)`
+         *             found by ADL
+         *
+         * @tparam     T    Type of the intermediate value
+         */
+        template<typename T>
+        struct has_reset_intermediate<T, std::void_t<decltype(resetIntermediate(std::declval<T &>()))>>
+            : std::true_type {};
+/** @} */
+
+        /**
+         * @brief      Resets the intermediate value via the user hook, the
+         *             values without the hook are kept as is
+         *
+         * @param      aValue    The value to reset
+         */
+        template<typename T>
+        constexpr void resetValue(T & aValue) {
+            if constexpr (has_reset_intermediate<T>::value) {
+                resetIntermediate(aValue);
+            } else {
+                (void)aValue;
+            }
+        }
+
+        /**
+         * @brief      Workspace slot of the step. The out-params getters fill
+         *             the tuple kept in the slot, the step of the returning
+         *             getters is created from the returned value on every
+         *             call
+         *
+         * @tparam     Fx    Type of the method
+         */
+        template<typename Fx>
+        using workspace_slot_t = std::conditional_t<OwningInvokingStep<Fx>::IS_RETURNING,
+                                                    std::optional<OwningInvokingStep<Fx>>,
+                                                    step_result_t<Fx>>;
+
+    /** @{ */
+    /* slotTuple function, which returns the tuple of the workspace slot */
+        /**
+         * @brief      The out-params getters slot
+         */
+        template<typename Tuple>
+        constexpr Tuple & slotTuple(Tuple & aSlot) {
+            return aSlot;
+        }
+
+        /**
+         * @brief      The returning getters slot
+         */
+        template<typename Fx>
+        constexpr auto & slotTuple(std::optional<OwningInvokingStep<Fx>> & aSlot) {
+            return aSlot->tuple;
+        }
+    /** @} */
+    } /* end of namespace detail */
+
+    /**
+     * @brief      Workspace policy: every intermediate tuple is reassigned
+     *             with the value-initialized one before the getter is
+     *             invoked. Same results as without the workspace, but the
+     *             storage itself is reused
+     */
+    struct reconstruct_intermediates {
+        template<typename Tuple>
+        static constexpr void prepare(Tuple & aTuple) {
+            aTuple = Tuple{};
+        }
+    };
+
+    /**
+     * @brief      Workspace policy: every intermediate value is reset via the
+     *             `resetIntermediate(T &)` function found by ADL, the values
+     *             without such function are kept from the previous call and
+     *             simply overwritten by the getters
+     *
+     * @note       Nothing is constructed or destroyed per call, the getters
+     *             shall fully define the values they are filling
+     */
+    struct reset_intermediates {
+        template<typename Tuple>
+        static constexpr void prepare(Tuple & aTuple) {
+            std::apply([](auto & ... aValues) { (detail::resetValue(aValues), ...); }, aTuple);
+        }
+    };
+
+    /**
+     * @brief      Policy tag type, used to pass the policy into the workspace
+     *             object invoke constructor
+     *
+     * @tparam     T    Type of the policy
+     */
+    template<typename T>
+    struct policy { };
+
+    /**
+     * @brief      Creates the policy tag
+     *
+     * @tparam     T    Type of the policy
+     */
+    template<typename T>
+    constexpr auto usePolicy() {
+        return policy<T>{};
+    }
+
+    /**
+     * @brief      Workspace of the single methods chain: keeps the tuples of
+     *             all the steps, so they outlive the call
+     *
+     * @note       The policy is applied to the out-params getters only, the
+     *             returning getters create the value anyway
+     *
+     * @tparam     fx    Methods of the chain
+     */
+    template<auto ... fx>
+    struct chain_workspace {
+        using tuples_t = std::tuple<detail::workspace_slot_t<decltype(fx)>...>;
+
+        /**
+         * @brief      Invokes the chain, all the steps fill the tuples of the
+         *             workspace
+         *
+         * @tparam     TPolicy    The workspace policy
+         * @tparam     TObj       Type of the object
+         *
+         * @param      aObj       Object to start from
+         *
+         * @return     Tuple of the last step
+         */
+        template<typename TPolicy, typename TObj>
+        constexpr auto const & invoke(TObj & aObj) {
+            this->invokeStep<TPolicy, 0, fx...>(aObj);
+            return detail::slotTuple(std::get<sizeof...(fx) - 1>(m_tuples));
+        }
+    private:
+        /**
+         * @brief      Prepares the tuple of the step, invokes the step and
+         *             continues with the object from the filled tuple
+         *
+         * @tparam     TPolicy    The workspace policy
+         * @tparam     Idx        Index of the step
+         * @tparam     f          Method of the step
+         * @tparam     rest       The rest methods
+         */
+        template<typename TPolicy, size_t Idx, auto f, auto ... rest, typename TObj>
+        constexpr void invokeStep(TObj & aObj) {
+            using step_t = detail::OwningInvokingStep<decltype(f)>;
+
+            auto & slot { std::get<Idx>(m_tuples) };
+            if constexpr (step_t::IS_RETURNING) {
+                slot.emplace(std::integral_constant<decltype(f), f>{}, aObj);
+            } else {
+                TPolicy::prepare(slot);
+                step_t::fill(slot, std::integral_constant<decltype(f), f>{}, aObj);
+            }
+
+            if constexpr (0 != sizeof...(rest)) {
+                using next_t = typename detail::first_class<decltype(rest)...>::type;
+                this->invokeStep<TPolicy, Idx + 1, rest...>(detail::stepObject<next_t>(detail::slotTuple(slot)));
+            }
+        }
+
+        tuples_t m_tuples { };
+    };
+
+/** @{ */
+/* chain_workspace_of meta-function */
+    /**
+     * @brief      Initial definition, unused
+     *
+     * @tparam     TChain    The chain, values_list of methods
+     */
+    template<typename TChain>
+    struct chain_workspace_of;
+
+    /**
+     * @brief      Returns workspace type of the chain
+     *
+     * @tparam     fx    Methods of the chain
+     */
+    template<auto ... fx>
+    struct chain_workspace_of<values_list<fx...>> {
+        using type = chain_workspace<fx...>;
+    };
+
+    /**
+     * @brief      stl's _t standalone type
+     *
+     * @tparam     TChain    The chain, values_list of methods
+     */
+    template<typename TChain>
+    using chain_workspace_of_t = typename chain_workspace_of<TChain>::type;
+/** @} */
+
+    /**
+     * @brief      Initial definition, unused
+     */
+    template<typename TPolicy, typename TInvoke>
+    struct workspace_object_invoke;
+
+    /**
+     * @brief      The object invoke, which owns the preallocated workspace
+     *             for all the intermediate tuples of all the chains. The
+     *             workspace is allocated once, in the constructor, as the
+     *             single block, and is reused by every call, so no
+     *             intermediate object is constructed or destroyed per call
+     *             (besides the ones reconstructed by the policy)
+     *
+     * @note       Pays off for the heavy intermediates only (allocating
+     *             members, big buffers), the trivial ones are cheaper to
+     *             create on the stack, as the inline_object_invoke does
+     *
+     * @note       Unlike other flavors the invoke isn't const and can't be
+     *             used from several threads at once, every thread shall have
+     *             it's own copy
+     *
+     * @tparam     TPolicy            The workspace policy,
+     *                                reconstruct_intermediates or
+     *                                reset_intermediates
+     * @tparam     TResultAcceptor    Callable object, which invoked with the
+     *                                tag and the result of the function
+     * @tparam     TForwarders        Types of the delayed invoke forwarders
+     */
+    template<typename TPolicy, typename TResultAcceptor, typename ... TForwarders>
+    struct workspace_object_invoke<TPolicy, inline_object_invoke<TResultAcceptor, TForwarders...>> {
+    public:
+        using object_t    = detail::invokers_class_t<TForwarders...>;
+        using acceptor_t  = TResultAcceptor;
+        using workspace_t = std::tuple<chain_workspace_of_t<typename TForwarders::chain_t>...>;
+
+        static constexpr size_t INVOKERS_COUNT { sizeof...(TForwarders) };
+
+        /**
+         * @brief      Creates the workspace object invoke and allocates the
+         *             workspace
+         *
+         * @param      aInvoke    The inline object invoke to take the
+         *                        invokers from
+         */
+        workspace_object_invoke(policy<TPolicy>, inline_object_invoke<TResultAcceptor, TForwarders...> const & aInvoke)
+            : m_invokers  { aInvoke.invokers()            }
+            , m_workspace { std::make_unique<workspace_t>() }
+        {}
+
+        /**
+         * @brief      Copies the invokers, the copy gets it's own workspace
+         */
+        workspace_object_invoke(workspace_object_invoke const & aOther)
+            : m_invokers  { aOther.m_invokers             }
+            , m_workspace { std::make_unique<workspace_t>() }
+        {}
+
+        workspace_object_invoke(workspace_object_invoke &&) noexcept = default;
+
+        /**
+         * @brief      Invokes all the registered invokers and passes every
+         *             result into the acceptor. The result references the
+         *             workspace and is valid until the next call
+         */
+        void operator()(object_t & aObj, acceptor_t & aAcceptor) {
+            this->invokeImpl(std::index_sequence_for<TForwarders...>{}, aObj, aAcceptor);
+        }
+    private:
+        /**
+         * @brief      The implementation of the invoke, expands all the
+         *             invokers in the registration order
+         *
+         * @tparam     Idx    Indexes of the invokers
+         */
+        template<size_t ... Idx>
+        void invokeImpl(std::index_sequence<Idx...>, object_t & aObj, acceptor_t & aAcceptor) {
+            (aAcceptor(get<Idx>(m_invokers).tag(),
+                       std::get<Idx>(*m_workspace).template invoke<TPolicy>(aObj)), ...);
+        }
+
+        flat_tuple<TForwarders...>     m_invokers;
+        std::unique_ptr<workspace_t>   m_workspace;
+    };
+
+    /* class deduction guides */
+    template<typename TPolicy, typename TInvoke>
+    workspace_object_invoke(policy<TPolicy>, TInvoke) -> workspace_object_invoke<TPolicy, TInvoke>;
+
+} /* end of namespace mil */
+
+#endif /* end of #ifndef INCLUDE__WORKSPACE_OBJECT_INVOKE__H */
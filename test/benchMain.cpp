@@ -0,0 +1,1248 @@
+/**
+ * @file      benchMain.cpp
+ *
+ * @brief     Small benchmark for the different invoke engines
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <cstdio>
+#include <cstdlib>
+
+#include <object_invoke.h>
+#include <inline_object_invoke.h>
+#include <trie_object_invoke.h>
+#include <workspace_object_invoke.h>
+#include <batch_object_invoke.h>
+#include <parallel_object_invoke.h>
+#include <binary_acceptor.h>
+#include <frame_acceptor.h>
+#include <protobuf_acceptor.h>
+#include <flat_acceptor.h>
+#include <json_acceptor.h>
+#include <snapshot_cell.h>
+#include <column_codec.h>
+#include <object_apply.h>
+#include <object_registry.h>
+#include <async_object_invoke.h>
+#include <segment_acceptor.h>
+
+#if defined(__cpp_impl_coroutine)
+#include <coroutine>
+
+#include <poll.h>
+#include <unistd.h>
+#include <fcntl.h>
+#endif
+
+#if __has_include(<sys/mman.h>)
+#include <unistd.h>
+#endif
+
+using namespace mil::literals;
+
+namespace {
+    constexpr size_t ITERATIONS { 10'000'000ull };
+    constexpr size_t BATCH_SIZE { 10'000ull };
+
+    /**
+     * @brief      Prevents the compiler from throwing away the value
+     */
+    template<typename T>
+    inline void doNotOptimize(T const & aValue) {
+        asm volatile("" : : "r,m"(aValue) : "memory");
+    }
+
+    /**
+     * @brief      Measures average time of the single snapshot
+     *
+     * @param      aName          Name of the benchmark
+     * @param      aIterations    Number of calls
+     * @param      aSnapshots     Number of snapshots done by the single call
+     * @param      aFn            Function to measure
+     */
+    template<typename TFn>
+    void measure(char const * aName, size_t aIterations, size_t aSnapshots, TFn && aFn) {
+        auto const begin { std::chrono::steady_clock::now() };
+        for (size_t i { 0 }; i < aIterations; ++i) {
+            aFn();
+        }
+        auto const end { std::chrono::steady_clock::now() };
+        auto const ns { std::chrono::duration<double, std::nano>(end - begin).count() };
+
+        std::cout << std::left << std::setw(40) << aName
+                  << std::right << std::setw(10) << std::fixed << std::setprecision(2)
+                  << ns / static_cast<double>(aIterations * aSnapshots) << " ns/snapshot\n";
+    }
+
+    /**
+     * @brief      Same as above, for the single snapshot per call
+     */
+    template<typename TFn>
+    void measure(char const * aName, TFn && aFn) {
+        measure(aName, ITERATIONS, 1, std::forward<TFn>(aFn));
+    }
+
+}
+
+struct Object1 {
+    int value { 0 };
+
+    void getValue(int & i) {
+        i = value;
+    }
+
+    void setValue(int i) {
+        value = i;
+    }
+
+    int const & valueRef() const {
+        return value;
+    }
+};
+
+struct Object2 {
+    int value { 0 };
+    Object1 child { };
+
+    void getObject1(Object1 & obj) {
+        obj.value = value + 1;
+    }
+
+    Object1 & object1() {
+        return child;
+    }
+
+    uint64_t version { 0 };
+};
+
+uint64_t versionStamp(Object2 const & aObj) {
+    return aObj.version;
+}
+
+struct Object3 {
+    int value { 0 };
+    Object2 child { };
+
+    void getObject2(Object2 * obj) {
+        obj->value = value + 1;
+    }
+
+    Object2 & object2() {
+        return child;
+    }
+};
+
+struct Sink {
+    uint64_t sum;
+
+    template<typename ... T>
+    void operator()(char const * tag, std::tuple<T...> const & aTuple) {
+        sum += static_cast<uint64_t>(std::get<0>(aTuple)) + static_cast<unsigned char>(tag[4]);
+    }
+};
+
+struct MergingSink {
+    uint64_t sum { 0 };
+
+    template<typename ... T>
+    void operator()(char const * tag, std::tuple<T...> const & aTuple) {
+        sum += static_cast<uint64_t>(std::get<0>(aTuple)) + static_cast<unsigned char>(tag[4]);
+    }
+
+    void merge(MergingSink && aOther) {
+        sum += aOther.sum;
+    }
+};
+
+struct ColumnSink {
+    uint64_t sum;
+
+    template<typename ... T>
+    void operator()(char const * tag, mil::columns<T...> const & aColumns) {
+        auto const * values { aColumns.template column<0>() };
+        for (size_t i { 0 }; i < aColumns.size; ++i) {
+            sum += static_cast<uint64_t>(values[i]) + static_cast<unsigned char>(tag[4]);
+        }
+    }
+};
+
+constexpr mil::object_invoke pointersInvoke {
+    mil::useAcceptor<Sink>(),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call1"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call2"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call3"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call4")
+};
+
+constexpr mil::inline_object_invoke inlineInvoke {
+    mil::useAcceptor<Sink>(),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call1"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call2"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call3"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call4")
+};
+
+constexpr mil::inline_object_invoke referenceInvoke {
+    mil::useAcceptor<Sink>(),
+    mil::delayedInvoke<&Object3::object2, &Object2::object1, &Object1::valueRef>("call1"),
+    mil::delayedInvoke<&Object3::object2, &Object2::object1, &Object1::valueRef>("call2"),
+    mil::delayedInvoke<&Object3::object2, &Object2::object1, &Object1::valueRef>("call3"),
+    mil::delayedInvoke<&Object3::object2, &Object2::object1, &Object1::valueRef>("call4")
+};
+
+constexpr mil::trie_object_invoke versionedInvoke {
+    mil::useAcceptor<Sink>(),
+    mil::delayedInvoke<&Object3::object2, &Object2::object1, &Object1::valueRef>("call1"),
+    mil::delayedInvoke<&Object3::object2, &Object2::object1, &Object1::valueRef>("call2"),
+    mil::delayedInvoke<&Object3::object2, &Object2::object1, &Object1::valueRef>("call3"),
+    mil::delayedInvoke<&Object3::object2, &Object2::object1, &Object1::valueRef>("call4")
+};
+
+constexpr mil::trie_object_invoke trieInvoke {
+    mil::useAcceptor<Sink>(),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call1"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call2"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call3"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call4")
+};
+
+constexpr mil::batch_object_invoke batchInvoke {
+    mil::useAcceptor<ColumnSink>(),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call1"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call2"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call3"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call4")
+};
+
+constexpr mil::object_invoke mergingInvoke {
+    mil::useAcceptor<MergingSink>(),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call1"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call2"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call3"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call4")
+};
+
+constexpr mil::inline_object_invoke binaryInvoke {
+    mil::useAcceptor<mil::binary_acceptor>(),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call1"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call2"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call3"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call4")
+};
+
+constexpr mil::inline_object_invoke binaryTaggedInvoke {
+    mil::useAcceptor<mil::binary_acceptor>(),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call1"_tag),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call2"_tag),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call3"_tag),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call4"_tag)
+};
+
+constexpr mil::object_apply binaryApply {
+    mil::delayedApply<&Object3::object2, &Object2::object1, &Object1::setValue>("call1"_tag),
+    mil::delayedApply<&Object3::object2, &Object2::object1, &Object1::setValue>("call2"_tag),
+    mil::delayedApply<&Object3::object2, &Object2::object1, &Object1::setValue>("call3"_tag),
+    mil::delayedApply<&Object3::object2, &Object2::object1, &Object1::setValue>("call4"_tag)
+};
+
+constexpr mil::inline_object_invoke frameInvoke {
+    mil::useAcceptor<mil::frame_acceptor>(),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call1"_tag),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call2"_tag),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call3"_tag),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call4"_tag)
+};
+
+constexpr auto frameSchema { frameInvoke.schema() };
+
+constexpr mil::inline_object_invoke protobufInvoke {
+    mil::useAcceptor<mil::protobuf_acceptor>(),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call1"_tag),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call2"_tag),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call3"_tag),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call4"_tag)
+};
+
+constexpr auto protobufSchema { protobufInvoke.schema() };
+
+constexpr mil::inline_object_invoke flatInvoke {
+    mil::useAcceptor<mil::flat_acceptor>(),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call1"_tag),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call2"_tag),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call3"_tag),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call4"_tag)
+};
+
+constexpr auto   flatSchema { flatInvoke.schema()       };
+constexpr size_t FLAT_CALL3 { flatSchema.find("call3") };
+
+/**
+ * @brief      The JSON acceptor, which formats the values by the stream
+ */
+struct StreamSink {
+    std::ostringstream   os;
+    bool                 first;
+
+    template<typename ... T>
+    void operator()(char const * tag, std::tuple<T...> const & aTuple) {
+        os << (first ? "{\"" : ",\"") << tag << "\":";
+        putStream(os, aTuple, std::make_index_sequence<sizeof...(T)>{});
+        first = false;
+    }
+
+    template<typename Tuple, size_t ... Idx>
+    static std::ostream & putStream(std::ostream & aOs, Tuple const & t, std::index_sequence<Idx...>) {
+        return (aOs << ... << std::get<Idx>(t));
+    }
+};
+
+constexpr mil::object_invoke streamInvoke {
+    mil::useAcceptor<StreamSink>(),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call1"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call2"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call3"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call4")
+};
+
+constexpr mil::object_invoke jsonInvoke {
+    mil::useAcceptor<mil::json_acceptor>(),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call1"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call2"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call3"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call4")
+};
+
+constexpr auto jsonSchema { jsonInvoke.schema() };
+
+#if __has_include(<sys/mman.h>)
+constexpr mil::inline_object_invoke segmentInvoke {
+    mil::useAcceptor<mil::segment_acceptor>(),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call1"_tag),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call2"_tag),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call3"_tag),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call4"_tag)
+};
+#endif
+
+#if defined(__cpp_impl_coroutine)
+/**
+ * @brief      Local stand-in of the asynchronous sink: the records are
+ *             buffered and written into the non-blocking pipe. The awaitable
+ *             isn't ready, while the pending data is above the watermark, the
+ *             waiting snapshots are resumed by poll(), when the pipe becomes
+ *             writable
+ */
+class PipeSink {
+public:
+    static constexpr size_t WATERMARK { 4096 };
+
+    struct awaitable {
+        PipeSink & sink;
+
+        bool await_ready() const noexcept {
+            return sink.m_pending.size() < WATERMARK;
+        }
+
+        void await_suspend(std::coroutine_handle<> aHandle) {
+            sink.m_waiters.push_back(aHandle);
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    explicit PipeSink(int aFd)
+        : m_fd { aFd }
+    {
+        m_pending.reserve(WATERMARK * 2);
+    }
+
+    template<typename ... T>
+    awaitable operator()(char const * tag, std::tuple<T...> const & aTuple) {
+        int const value { std::get<0>(aTuple) };
+        m_pending.insert(m_pending.end(), tag, tag + 5);
+        m_pending.insert(m_pending.end(), reinterpret_cast<char const *>(&value), reinterpret_cast<char const *>(&value + 1));
+        if (m_pending.size() >= WATERMARK) {
+            this->flush();
+        }
+        return awaitable{ *this };
+    }
+
+    /**
+     * @brief      Waits until the pipe is writable, flushes the pending data
+     *             and resumes the waiting snapshots, once it's below the
+     *             watermark
+     *
+     * @return     false, if nobody waits
+     */
+    bool poll() {
+        if (m_waiters.empty()) {
+            return false;
+        }
+        this->waitWritable();
+        this->flush();
+        if (m_pending.size() < WATERMARK) {
+            std::swap(m_waiters, m_resumed);
+            for (auto const handle: m_resumed) {
+                handle.resume();
+            }
+            m_resumed.clear();
+        }
+        return true;
+    }
+
+    /**
+     * @brief      Blocks, while the pending data is above the watermark
+     */
+    void wait() {
+        while (m_pending.size() >= WATERMARK) {
+            this->waitWritable();
+            this->flush();
+        }
+    }
+private:
+    void waitWritable() const {
+        pollfd fd { m_fd, POLLOUT, 0 };
+        ::poll(&fd, 1, -1);
+    }
+
+    void flush() {
+        ssize_t const written { ::write(m_fd, m_pending.data(), m_pending.size()) };
+        if (written > 0) {
+            m_pending.erase(m_pending.begin(), m_pending.begin() + written);
+        }
+    }
+
+    int                                    m_fd;
+    std::vector<char>                      m_pending;
+    std::vector<std::coroutine_handle<>>   m_waiters;
+    std::vector<std::coroutine_handle<>>   m_resumed;
+};
+
+/**
+ * @brief      The synchronous counterpart, blocks the thread under the
+ *             backpressure
+ */
+struct BlockingPipeSink {
+    PipeSink & sink;
+
+    template<typename ... T>
+    void operator()(char const * tag, std::tuple<T...> const & aTuple) {
+        sink(tag, aTuple);
+        sink.wait();
+    }
+};
+
+constexpr mil::inline_object_invoke pipeInvoke {
+    mil::useAcceptor<PipeSink>(),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call1"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call2"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call3"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call4")
+};
+
+constexpr mil::async_object_invoke asyncInvoke { pipeInvoke };
+
+constexpr mil::inline_object_invoke blockingInvoke {
+    mil::useAcceptor<BlockingPipeSink>(),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call1"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call2"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call3"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call4")
+};
+
+/**
+ * @brief      Snapshots the object several times, every snapshot is awaited
+ *             before the next one
+ *
+ * @param      aObj          The object
+ * @param      aSink         The sink
+ * @param      aCount        Number of the snapshots
+ * @param      aLatencies    Latencies of the snapshots, ns
+ */
+static mil::task snapshots(Object3 & aObj, PipeSink & aSink, size_t aCount, std::vector<double> & aLatencies) {
+    for (size_t i { 0 }; i < aCount; ++i) {
+        ++aObj.value;
+        auto const begin { std::chrono::steady_clock::now() };
+        co_await asyncInvoke(aObj, aSink);
+        aLatencies.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count());
+    }
+}
+
+/**
+ * @brief      Prints the latency percentiles of the snapshots
+ *
+ * @param      aName         Name of the benchmark
+ * @param      aLatencies    Latencies of the single snapshots, ns
+ */
+static void latency(char const * aName, std::vector<double> & aLatencies) {
+    std::sort(aLatencies.begin(), aLatencies.end());
+    auto const percentile = [&](double aP) {
+        return aLatencies[static_cast<size_t>(aP * static_cast<double>(aLatencies.size() - 1))];
+    };
+
+    std::cout << std::left << std::setw(40) << aName << std::right << std::fixed << std::setprecision(0)
+              << " p50 " << percentile(0.5) << " ns, p99 " << percentile(0.99)
+              << " ns, max " << aLatencies.back() << " ns\n";
+}
+
+/**
+ * @brief      Measures the latency of the snapshots written into the pipe,
+ *             drained by the other thread: the blocking sink, and the async
+ *             invoke with several snapshots interleaved by the single thread
+ */
+static void pipeLatency() {
+    constexpr size_t SNAPSHOTS { 1'000'000ull };
+    constexpr size_t IN_FLIGHT { 64 };
+
+    int fds[2];
+    if (0 != ::pipe(fds)) {
+        return;
+    }
+    std::thread reader { [fd = fds[0]] {
+        char buffer[65536];
+        while (::read(fd, buffer, sizeof(buffer)) > 0) {}
+    } };
+    ::fcntl(fds[1], F_SETFL, ::fcntl(fds[1], F_GETFL) | O_NONBLOCK);
+
+    PipeSink pipeSink { fds[1] };
+    std::vector<double> latencies;
+    latencies.reserve(SNAPSHOTS);
+
+    Object3 obj { 0 };
+    BlockingPipeSink blockingSink { pipeSink };
+    for (size_t i { 0 }; i < SNAPSHOTS; ++i) {
+        ++obj.value;
+        auto const begin { std::chrono::steady_clock::now() };
+        blockingInvoke(obj, blockingSink);
+        latencies.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count());
+    }
+    latency("inline_object_invoke, blocking pipe", latencies);
+    latencies.clear();
+
+    std::vector<Object3> objects(IN_FLIGHT, Object3{ 0 });
+    std::vector<mil::task> tasks;
+    for (auto & object: objects) {
+        tasks.push_back(snapshots(object, pipeSink, SNAPSHOTS / IN_FLIGHT, latencies));
+        tasks.back().start();
+    }
+    while (pipeSink.poll()) {}
+    latency("async_object_invoke, pipe, 64 in flight", latencies);
+
+    ::close(fds[1]);
+    reader.join();
+    ::close(fds[0]);
+}
+#endif
+
+#if __has_include(<sys/mman.h>)
+/**
+ * @brief      Measures the snapshots persisted into the file: the binary
+ *             records written by the buffered stream, the segment files, and
+ *             the segment files read back and applied to the object
+ */
+static void segmentThroughput() {
+    constexpr size_t SNAPSHOTS { 1'000'000ull };
+
+    char const * const tmp { std::getenv("TMPDIR") };
+    std::string const prefix { std::string{ nullptr != tmp ? tmp : "/tmp" } + "/mil_benchmark_" + std::to_string(::getpid()) };
+
+    Object3 obj { 0 };
+    unsigned char buffer[256];
+    mil::binary_acceptor binary { buffer, sizeof(buffer) };
+    std::FILE * const file { std::fopen((prefix + ".bin").c_str(), "wb") };
+    if (nullptr != file) {
+        measure("inline_object_invoke, binary, fwrite", SNAPSHOTS, 1, [&] {
+            ++obj.value;
+            binary.reset();
+            binaryTaggedInvoke(obj, binary);
+            std::fwrite(binary.data(), 1, binary.size(), file);
+        });
+        std::fclose(file);
+        std::remove((prefix + ".bin").c_str());
+    }
+
+    mil::segment_acceptor segment { };
+    if (segment.open(prefix)) {
+        measure("inline_object_invoke, segment", SNAPSHOTS, 1, [&] {
+            ++obj.value;
+            segmentInvoke(obj, segment);
+        });
+    }
+    segment.close();
+
+    Object3 target { 0 };
+    mil::segment_reader reader { };
+    mil::segment_record record { };
+    reader.open(prefix);
+    measure("segment_reader, object_apply", SNAPSHOTS, 1, [&] {
+        for (size_t i { 0 }; i < decltype(segmentInvoke)::INVOKERS_COUNT && reader.next(record); ++i) {
+            binaryApply(target, record.data, record.size);
+        }
+        doNotOptimize(target);
+    });
+    reader.close();
+
+    for (uint64_t i { 0 }; i <= segment.segment(); ++i) {
+        std::remove(mil::detail::segmentPath(prefix, i).c_str());
+    }
+    std::cout << "segments: " << segment.segment() + 1 << ", failed: " << segment.failed()
+              << ", read back: " << target.child.child.value << std::endl;
+}
+#endif
+
+constexpr mil::inline_object_invoke object1Invoke {
+    mil::useAcceptor<Sink>(),
+    mil::delayedInvoke<&Object1::getValue>("call1"),
+    mil::delayedInvoke<&Object1::getValue>("call2")
+};
+
+constexpr mil::inline_object_invoke object2Invoke {
+    mil::useAcceptor<Sink>(),
+    mil::delayedInvoke<&Object2::getObject1, &Object1::getValue>("call1"),
+    mil::delayedInvoke<&Object2::getObject1, &Object1::getValue>("call2"),
+    mil::delayedInvoke<&Object2::getObject1, &Object1::getValue>("call3")
+};
+
+constexpr mil::object_registry fleetRegistry { object1Invoke, object2Invoke, inlineInvoke };
+
+/**
+ * @brief      The virtual dispatch layer, the registry replaces
+ */
+struct FleetNode {
+    virtual ~FleetNode() = default;
+    virtual void snapshot(Sink & aSink) = 0;
+    virtual mil::object_ref ref() = 0;
+};
+
+template<typename T, auto const & invoke>
+struct TypedFleetNode : FleetNode {
+    T object { };
+
+    void snapshot(Sink & aSink) override {
+        invoke(object, aSink);
+    }
+
+    mil::object_ref ref() override {
+        return fleetRegistry.ref(object);
+    }
+};
+
+/**
+ * @brief      Measures the snapshots of the mixed fleet of the objects of
+ *             three types: the virtual calls, the registry dispatch per
+ *             object, and the registry dispatch per run of the objects
+ *             sorted by type
+ */
+static void fleetDispatch() {
+    constexpr size_t FLEET_SIZE { 3'000 };
+    constexpr size_t ROUNDS     { 3'000 };
+
+    std::vector<std::unique_ptr<FleetNode>> fleet;
+    uint32_t random { 1 };
+    for (size_t i { 0 }; i < FLEET_SIZE; ++i) {
+        random = random * 1664525u + 1013904223u;
+        switch ((random >> 16) % 3) {
+        case 0:  fleet.push_back(std::make_unique<TypedFleetNode<Object1, object1Invoke>>()); break;
+        case 1:  fleet.push_back(std::make_unique<TypedFleetNode<Object2, object2Invoke>>()); break;
+        default: fleet.push_back(std::make_unique<TypedFleetNode<Object3, inlineInvoke>>());  break;
+        }
+    }
+
+    std::vector<mil::object_ref> refs;
+    for (auto const & node: fleet) {
+        refs.push_back(node->ref());
+    }
+
+    Sink sink { 0 };
+    measure("fleet, virtual", ROUNDS, FLEET_SIZE, [&] {
+        for (auto const & node: fleet) {
+            node->snapshot(sink);
+        }
+        doNotOptimize(sink);
+    });
+
+    measure("fleet, object_registry", ROUNDS, FLEET_SIZE, [&] {
+        for (auto const ref: refs) {
+            fleetRegistry(ref, sink);
+        }
+        doNotOptimize(sink);
+    });
+
+    measure("fleet, object_registry, unsorted", ROUNDS, FLEET_SIZE, [&] {
+        fleetRegistry(refs, sink);
+        doNotOptimize(sink);
+    });
+
+    fleetRegistry.sort(refs);
+    measure("fleet, object_registry, sorted", ROUNDS, FLEET_SIZE, [&] {
+        fleetRegistry(refs, sink);
+        doNotOptimize(sink);
+    });
+
+    std::cout << "fleet checksum: " << sink.sum << std::endl;
+}
+
+/**
+ * @brief      The column acceptor, which encodes every column as the group
+ *             varint of the zigzag differences
+ */
+struct CodecSink {
+    mil::column_codec            codec;
+    std::vector<unsigned char>   out;
+    size_t                       size;
+
+    template<typename T>
+    void operator()(char const *, mil::columns<T> const & aColumns) {
+        static_assert(std::is_same_v<T, int32_t>, "Only int32_t columns are encoded");
+        size += codec.deltaVarint(aColumns.template column<0>(), aColumns.size, out.data() + size);
+    }
+};
+
+constexpr mil::batch_object_invoke codecInvoke {
+    mil::useAcceptor<CodecSink>(),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call1"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call2"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call3"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call4")
+};
+
+/**
+ * @brief      Measures the throughput of the encoding function in GB/s of
+ *             the input
+ *
+ * @param      aName     Name of the benchmark
+ * @param      aBytes    Size of the input
+ * @param      aFn       Function to measure, returns the encoded size
+ */
+template<typename TFn>
+static void throughput(std::string const & aName, size_t aBytes, TFn && aFn) {
+    constexpr size_t ROUNDS { 2'000 };
+
+    size_t encoded { 0 };
+    auto const begin { std::chrono::steady_clock::now() };
+    for (size_t i { 0 }; i < ROUNDS; ++i) {
+        encoded = aFn();
+        doNotOptimize(encoded);
+    }
+    auto const end { std::chrono::steady_clock::now() };
+    auto const ns { std::chrono::duration<double, std::nano>(end - begin).count() };
+
+    std::cout << std::left << std::setw(40) << aName
+              << std::right << std::setw(10) << std::fixed << std::setprecision(2)
+              << static_cast<double>(aBytes * ROUNDS) / ns << " GB/s, "
+              << std::setprecision(2) << 8.0 * static_cast<double>(encoded) / static_cast<double>(aBytes / sizeof(int32_t))
+              << " bits/value\n";
+}
+
+/**
+ * @brief      Measures the column kernels of every supported instruction
+ *             set on the counter-like column, and the batch invoke, which
+ *             encodes it's columns
+ */
+static void codecThroughput() {
+    constexpr size_t COLUMN { 1u << 16 };
+
+    std::vector<int32_t> counters(COLUMN);
+    uint32_t random  { 1 };
+    int32_t  counter { 1'000'000 };
+    for (auto & value: counters) {
+        random  = random * 1664525u + 1013904223u;
+        counter += static_cast<int32_t>((random >> 16) % 100);
+        value    = counter;
+    }
+
+    std::vector<uint32_t>      deltas(COLUMN);
+    std::vector<unsigned char> out(std::max(mil::column_codec::groupVarintBound(COLUMN), mil::column_codec::bitpackBound(COLUMN)));
+    char const * const         names[] { "scalar", "sse4", "avx2" };
+    for (auto const level: { mil::simd_level::scalar, mil::simd_level::sse4, mil::simd_level::avx2 }) {
+        mil::column_codec const codec { level };
+        if (codec.level() != level) {
+            continue;
+        }
+        std::string const name { names[static_cast<size_t>(level)] };
+
+        throughput("column, delta zigzag, " + name, COLUMN * sizeof(int32_t), [&] {
+            codec.deltaZigzag(counters.data(), COLUMN, deltas.data());
+            return COLUMN * sizeof(uint32_t);
+        });
+        throughput("column, group varint, " + name, COLUMN * sizeof(int32_t), [&] {
+            return codec.groupVarint(deltas.data(), COLUMN, out.data());
+        });
+        throughput("column, bit packing, " + name, COLUMN * sizeof(int32_t), [&] {
+            return codec.bitpack(deltas.data(), COLUMN, out.data());
+        });
+        throughput("column, delta varint, " + name, COLUMN * sizeof(int32_t), [&] {
+            return codec.deltaVarint(counters.data(), COLUMN, out.data());
+        });
+        throughput("column, delta bit packing, " + name, COLUMN * sizeof(int32_t), [&] {
+            return codec.deltaBitpack(counters.data(), COLUMN, out.data());
+        });
+    }
+
+    std::vector<int32_t> decoded(COLUMN);
+    size_t const size { mil::column_codec{}.deltaBitpack(counters.data(), COLUMN, out.data()) };
+    mil::column_codec::deltaBitpackDecode(out.data(), size, decoded.data(), COLUMN);
+    std::cout << "column round-trip: " << (decoded == counters ? "ok" : "MISMATCH") << std::endl;
+
+    std::vector<Object3> objects(BATCH_SIZE, Object3{ 0 });
+    decltype(codecInvoke)::buffers_t buffers;
+    CodecSink codecSink { mil::column_codec{}, std::vector<unsigned char>(4 * mil::column_codec::groupVarintBound(BATCH_SIZE)), 0 };
+    measure("batch_object_invoke, delta varint", ITERATIONS / BATCH_SIZE, BATCH_SIZE, [&] {
+        for (auto & object: objects) {
+            object.value += 3;
+        }
+        codecSink.size = 0;
+        codecInvoke(objects, buffers, codecSink);
+        doNotOptimize(codecSink);
+    });
+    std::cout << "batch, delta varint: " << codecSink.size << " bytes per " << BATCH_SIZE << " objects" << std::endl;
+}
+
+/**
+ * @brief      Returns true, if all the tags of the flat snapshot have the same
+ *             value, i.e. the snapshot isn't torn
+ */
+static bool consistent(mil::flat_view const & aView) {
+    int first { 0 };
+    int value { 0 };
+    aView.get(0, 0, first);
+    for (size_t i { 1 }; i < flatSchema.entries.size(); ++i) {
+        aView.get(i, 0, value);
+        if (value != first) {
+            return false;
+        }
+    }
+    return aView.valid();
+}
+
+/**
+ * @brief      Measures the writer, which updates the object, while the
+ *             readers take it's snapshots: by the invoke of the live object
+ *             under the mutex, and by the copy of the snapshot_cell
+ */
+static void contention() {
+    constexpr size_t UPDATES { 2'000'000 };
+    using cell_t = mil::snapshot_cell<flatSchema.flatSize>;
+
+    for (size_t readers { 1 }; readers <= 8; readers *= 2) {
+        Object3               obj     { 0 };
+        std::mutex            mutex;
+        cell_t                cell;
+        std::atomic<bool>     running { true };
+        std::atomic<uint64_t> reads   { 0 };
+        std::atomic<uint64_t> torn    { 0 };
+        std::atomic<size_t>   started { 0 };
+
+        auto const run { [&](char const * aName, auto && aRead, auto && aWrite) {
+            running = true;
+            reads   = 0;
+            torn    = 0;
+            started = 0;
+            std::vector<std::thread> threads;
+            for (size_t i { 0 }; i < readers; ++i) {
+                threads.emplace_back([&] {
+                    uint64_t count { 0 };
+                    uint64_t bad   { 0 };
+                    ++started;
+                    while (running.load(std::memory_order_relaxed)) {
+                        bad += aRead() ? 0 : 1;
+                        ++count;
+                    }
+                    reads += count;
+                    torn  += bad;
+                });
+            }
+
+            while (started.load() != readers) {
+                std::this_thread::yield();
+            }
+
+            auto const name { std::string(aName) + ", " + std::to_string(readers) + " readers" };
+            auto const begin { std::chrono::steady_clock::now() };
+            measure(name.c_str(), UPDATES, 1, aWrite);
+            auto const ns { std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count() };
+            running = false;
+            for (auto & thread: threads) {
+                thread.join();
+            }
+            std::cout << "    reads: " << std::fixed << std::setprecision(2) << static_cast<double>(reads) * 1e3 / ns
+                      << " per us, torn: " << torn << std::endl;
+        } };
+
+        run("mutex, object_invoke", [&] {
+            alignas(8) unsigned char snapshot[flatSchema.flatSize];
+            mil::flat_acceptor acceptor { snapshot, sizeof(snapshot) };
+            {
+                std::lock_guard<std::mutex> const lock { mutex };
+                acceptor.begin(flatSchema);
+                flatInvoke(obj, acceptor);
+                acceptor.end();
+            }
+            return consistent(mil::flat_view{ snapshot, sizeof(snapshot), flatSchema });
+        }, [&] {
+            std::lock_guard<std::mutex> const lock { mutex };
+            ++obj.value;
+        });
+
+        cell.publish(flatInvoke, obj, flatSchema);
+        run("snapshot_cell", [&] {
+            cell_t::snapshot_t snapshot;
+            cell.load(snapshot);
+            return consistent(mil::flat_view{ snapshot.data(), flatSchema.flatSize, flatSchema });
+        }, [&] {
+            ++obj.value;
+            cell.publish(flatInvoke, obj, flatSchema);
+        });
+    }
+}
+
+/**
+ * @brief      Hand-written equivalent of the invokers above
+ */
+static void handWritten(Object3 & aObj, Sink & aSink) {
+    for (char const * tag: { "call1", "call2", "call3", "call4" }) {
+        Object2 obj2 {};
+        aObj.getObject2(&obj2);
+        Object1 obj1 {};
+        obj2.getObject1(obj1);
+        int value {};
+        obj1.getValue(value);
+        aSink(tag, std::tuple<int>{ value });
+    }
+}
+
+int main() {
+    Object3 obj { 0 };
+    Sink sink { 0 };
+
+    measure("object_invoke", [&] {
+        ++obj.value;
+        pointersInvoke(obj, sink);
+        doNotOptimize(sink);
+    });
+
+    mil::delta_state<decltype(pointersInvoke)::size()> deltaState;
+    measure("object_invoke, delta, unchanged", [&] {
+        auto const changed { pointersInvoke(obj, sink, deltaState) };
+        doNotOptimize(changed);
+        doNotOptimize(sink);
+    });
+
+    measure("object_invoke, delta, changed", [&] {
+        ++obj.value;
+        auto const changed { pointersInvoke(obj, sink, deltaState) };
+        doNotOptimize(changed);
+        doNotOptimize(sink);
+    });
+
+    mil::field_mask<decltype(pointersInvoke)::size()> const oneField { 2 };
+    measure("object_invoke, mask of 1", [&] {
+        ++obj.value;
+        pointersInvoke(obj, sink, oneField);
+        doNotOptimize(sink);
+    });
+
+    mil::field_selection<decltype(pointersInvoke)::size()> const oneFieldSelection { oneField };
+    measure("object_invoke, selection of 1", [&] {
+        ++obj.value;
+        pointersInvoke(obj, sink, oneFieldSelection);
+        doNotOptimize(sink);
+    });
+
+    mil::invoke_stats<decltype(pointersInvoke)::size()> stats;
+    measure("object_invoke, stats", [&] {
+        ++obj.value;
+        pointersInvoke(obj, sink, stats);
+        doNotOptimize(sink);
+    });
+
+    std::atomic<bool> reading { true };
+    uint64_t observed { 0 };
+    std::thread statsReader { [&] {
+        while (reading.load(std::memory_order_relaxed)) {
+            observed += stats.tags[0].snapshot().count;
+        }
+    } };
+    measure("object_invoke, stats, read by thread", [&] {
+        ++obj.value;
+        pointersInvoke(obj, sink, stats);
+        doNotOptimize(sink);
+    });
+    reading = false;
+    statsReader.join();
+    doNotOptimize(observed);
+
+    for (size_t i { 0 }; i < stats.tags.size(); ++i) {
+        auto const snapshot { stats.tags[i].snapshot() };
+        std::cout << "    " << pointersInvoke[i].tag() << ": " << snapshot.count << " calls, "
+                  << static_cast<double>(snapshot.ticks) / static_cast<double>(snapshot.count) << " ticks/call\n";
+    }
+
+    measure("inline_object_invoke", [&] {
+        ++obj.value;
+        inlineInvoke(obj, sink);
+        doNotOptimize(sink);
+    });
+
+    measure("trie_object_invoke", [&] {
+        ++obj.value;
+        trieInvoke(obj, sink);
+        doNotOptimize(sink);
+    });
+
+    measure("inline_object_invoke, references", [&] {
+        ++obj.child.child.value;
+        referenceInvoke(obj, sink);
+        doNotOptimize(sink);
+    });
+
+    decltype(versionedInvoke)::version_state_t versionState;
+    measure("trie_object_invoke, versioned, unchanged", [&] {
+        auto const invoked { versionedInvoke(obj, sink, versionState) };
+        doNotOptimize(invoked);
+        doNotOptimize(sink);
+    });
+
+    measure("trie_object_invoke, versioned, changed", [&] {
+        ++obj.child.child.value;
+        ++obj.child.version;
+        auto const invoked { versionedInvoke(obj, sink, versionState) };
+        doNotOptimize(invoked);
+        doNotOptimize(sink);
+    });
+
+    mil::workspace_object_invoke reconstructInvoke { mil::usePolicy<mil::reconstruct_intermediates>(), inlineInvoke };
+    measure("workspace_object_invoke, reconstruct", [&] {
+        ++obj.value;
+        reconstructInvoke(obj, sink);
+        doNotOptimize(sink);
+    });
+
+    mil::workspace_object_invoke resetInvoke { mil::usePolicy<mil::reset_intermediates>(), inlineInvoke };
+    measure("workspace_object_invoke, reset", [&] {
+        ++obj.value;
+        resetInvoke(obj, sink);
+        doNotOptimize(sink);
+    });
+
+    measure("hand-written", [&] {
+        ++obj.value;
+        handWritten(obj, sink);
+        doNotOptimize(sink);
+    });
+
+    unsigned char buffer[256];
+    mil::binary_acceptor binary { buffer, sizeof(buffer) };
+
+    measure("inline_object_invoke, binary", [&] {
+        ++obj.value;
+        binary.reset();
+        binaryInvoke(obj, binary);
+        doNotOptimize(buffer);
+    });
+
+    measure("inline_object_invoke, binary, _tag", [&] {
+        ++obj.value;
+        binary.reset();
+        binaryTaggedInvoke(obj, binary);
+        doNotOptimize(buffer);
+    });
+
+    Object3 target { 0 };
+    measure("binary round-trip, _tag", [&] {
+        ++obj.value;
+        binary.reset();
+        binaryTaggedInvoke(obj, binary);
+        binaryApply(target, binary.data(), binary.size());
+        doNotOptimize(target);
+    });
+
+    mil::frame_acceptor frame { buffer, sizeof(buffer) };
+    measure("inline_object_invoke, frame", [&] {
+        ++obj.value;
+        frame.reset();
+        frame.begin(frameSchema);
+        frameInvoke(obj, frame);
+        frame.end();
+        doNotOptimize(buffer);
+    });
+
+    measure("frame round-trip", [&] {
+        ++obj.value;
+        frame.reset();
+        frame.begin(frameSchema);
+        frameInvoke(obj, frame);
+        frame.end();
+        binaryApply(target, frame.data(), frame.size(), frameSchema);
+        doNotOptimize(target);
+    });
+    std::cout << "frame: " << frameSchema.frameSize() << " bytes, binary records: " << binary.size() << " bytes" << std::endl;
+
+    mil::protobuf_acceptor protobuf { buffer, sizeof(buffer), protobufSchema };
+    measure("inline_object_invoke, protobuf", [&] {
+        ++obj.value;
+        protobuf.reset();
+        protobufInvoke(obj, protobuf);
+        doNotOptimize(buffer);
+    });
+    std::cout << "protobuf: " << protobuf.size() << " bytes" << std::endl;
+
+    alignas(8) unsigned char flatBuffer[256];
+    mil::flat_acceptor flat { flatBuffer, sizeof(flatBuffer) };
+    measure("inline_object_invoke, flat", [&] {
+        ++obj.value;
+        flat.reset();
+        flat.begin(flatSchema);
+        flatInvoke(obj, flat);
+        flat.end();
+        doNotOptimize(flatBuffer);
+    });
+
+    int flatValue { 0 };
+    measure("flat read, 1 tag", [&] {
+        mil::flat_view const view { flat.data(), flat.size(), flatSchema };
+        view.get(FLAT_CALL3, 0, flatValue);
+        doNotOptimize(flatValue);
+    });
+
+    binary.reset();
+    binaryTaggedInvoke(obj, binary);
+    measure("binary read, all tags", [&] {
+        binaryApply(target, binary.data(), binary.size());
+        doNotOptimize(target);
+    });
+    std::cout << "flat: " << flatSchema.flatSize << " bytes" << std::endl;
+
+    StreamSink stream { std::ostringstream{}, true };
+    measure("object_invoke, json, ostream", [&] {
+        ++obj.value;
+        stream.os.str(std::string{});
+        stream.first = true;
+        streamInvoke(obj, stream);
+        stream.os << "}\n";
+        doNotOptimize(stream);
+    });
+
+    mil::json_acceptor json;
+    measure("object_invoke, json", [&] {
+        ++obj.value;
+        json.reset();
+        json.begin();
+        jsonInvoke(obj, json);
+        json.end();
+        doNotOptimize(json);
+    });
+
+    mil::json_acceptor jsonKeys { jsonSchema };
+    measure("object_invoke, json, rendered keys", [&] {
+        ++obj.value;
+        jsonKeys.reset();
+        jsonKeys.begin();
+        jsonInvoke(obj, jsonKeys);
+        jsonKeys.end();
+        doNotOptimize(jsonKeys);
+    });
+    std::cout << "json: " << jsonKeys.view() << std::flush;
+
+    std::string const text { std::string(240, 'x') + "\"quoted\"\n" };
+    stream.first = true;
+    measure("json string, 256 chars, ostream", ITERATIONS / 10, 1, [&] {
+        stream.os.str(std::string{});
+        for (char const c: text) {
+            if ('"' == c || '\\' == c) {
+                stream.os << '\\' << c;
+            } else if ('\n' == c) {
+                stream.os << "\\n";
+            } else {
+                stream.os << c;
+            }
+        }
+        doNotOptimize(stream);
+    });
+    measure("json string, 256 chars", ITERATIONS / 10, 1, [&] {
+        json.reset();
+        json.begin();
+        json("text", std::tuple<std::string_view>{ text });
+        doNotOptimize(json);
+    });
+
+    std::vector<Object3> objects(BATCH_SIZE, Object3{ 0 });
+    decltype(batchInvoke)::buffers_t buffers;
+    ColumnSink columnSink { 0 };
+
+    measure("inline_object_invoke, range", ITERATIONS / BATCH_SIZE, BATCH_SIZE, [&] {
+        for (auto & object: objects) {
+            ++object.value;
+            inlineInvoke(object, sink);
+        }
+        doNotOptimize(sink);
+    });
+
+    measure("batch_object_invoke, range", ITERATIONS / BATCH_SIZE, BATCH_SIZE, [&] {
+        for (auto & object: objects) {
+            ++object.value;
+        }
+        batchInvoke(objects, buffers, columnSink);
+        doNotOptimize(columnSink);
+    });
+
+    MergingSink mergingSink { };
+    size_t const maxThreads { std::max(std::thread::hardware_concurrency(), 1u) };
+    for (size_t threads { 1 }; threads <= maxThreads; threads = threads < maxThreads ? std::min(threads * 2, maxThreads) : threads + 1) {
+        mil::thread_pool pool { threads };
+        mil::parallel_object_invoke parallelInvoke { mergingInvoke, pool };
+        auto const name { "parallel_object_invoke, " + std::to_string(threads) + " thr" };
+
+        measure(name.c_str(), ITERATIONS / BATCH_SIZE, BATCH_SIZE, [&] {
+            for (auto & object: objects) {
+                ++object.value;
+            }
+            parallelInvoke(objects, mergingSink);
+            doNotOptimize(mergingSink);
+        });
+    }
+
+#if defined(__cpp_impl_coroutine)
+    pipeLatency();
+#endif
+
+#if __has_include(<sys/mman.h>)
+    segmentThroughput();
+#endif
+
+    fleetDispatch();
+    codecThroughput();
+    contention();
+
+    std::cout << "checksum: " << target.child.child.value << ", " << mergingSink.sum << ", " << columnSink.sum << ", " << sink.sum << std::endl;
+    return 0;
+}
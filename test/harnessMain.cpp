@@ -0,0 +1,563 @@
+/**
+ * @file      harnessMain.cpp
+ *
+ * @brief     The benchmark harness of the invoke engine: runs the engines over
+ *            the synthetic schemas (chain depth, fan-out, number of tags, leaf
+ *            size) and reports ns per tag, instructions per tag and
+ *            allocations per snapshot in the machine-readable form
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <map>
+#include <new>
+#include <array>
+#include <tuple>
+#include <utility>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <object_invoke.h>
+#include <inline_object_invoke.h>
+#include <chain_invoke.h>
+
+#if defined(__linux__) && __has_include(<linux/perf_event.h>)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define MIL_HARNESS_PERF_EVENTS 1
+#endif
+
+namespace {
+    /**
+     * @brief      Number of the allocations done by the process
+     */
+    std::atomic<uint64_t> allocations { 0 };
+
+    /**
+     * @brief      Prevents the compiler from throwing away the value
+     */
+    template<typename T>
+    inline void doNotOptimize(T const & aValue) {
+        asm volatile("" : : "r,m"(aValue) : "memory");
+    }
+
+    /**
+     * @brief      Counter of the user-space instructions retired by the
+     *             thread, invalid if the perf events aren't available
+     */
+    class instructions_counter {
+    public:
+        instructions_counter() {
+#if defined(MIL_HARNESS_PERF_EVENTS)
+            perf_event_attr attr { };
+            attr.type           = PERF_TYPE_HARDWARE;
+            attr.size           = sizeof(attr);
+            attr.config         = PERF_COUNT_HW_INSTRUCTIONS;
+            attr.disabled       = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+            m_fd = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+        }
+
+        ~instructions_counter() {
+#if defined(MIL_HARNESS_PERF_EVENTS)
+            if (m_fd >= 0) {
+                ::close(m_fd);
+            }
+#endif
+        }
+
+        instructions_counter(instructions_counter const &) = delete;
+        instructions_counter & operator=(instructions_counter const &) = delete;
+
+        bool valid() const noexcept {
+            return m_fd >= 0;
+        }
+
+        void start() {
+#if defined(MIL_HARNESS_PERF_EVENTS)
+            if (m_fd >= 0) {
+                ::ioctl(m_fd, PERF_EVENT_IOC_RESET, 0);
+                ::ioctl(m_fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+#endif
+        }
+
+        uint64_t stop() {
+            uint64_t count { 0 };
+#if defined(MIL_HARNESS_PERF_EVENTS)
+            if (m_fd >= 0) {
+                ::ioctl(m_fd, PERF_EVENT_IOC_DISABLE, 0);
+                if (sizeof(count) != ::read(m_fd, &count, sizeof(count))) {
+                    count = 0;
+                }
+            }
+#endif
+            return count;
+        }
+    private:
+        int m_fd { -1 };
+    };
+}
+
+void * operator new(size_t aSize) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void * ptr { std::malloc(0 == aSize ? 1 : aSize) }) {
+        return ptr;
+    }
+    throw std::bad_alloc{ };
+}
+
+void operator delete(void * aPtr) noexcept {
+    std::free(aPtr);
+}
+
+void operator delete(void * aPtr, size_t) noexcept {
+    std::free(aPtr);
+}
+
+/**
+ * @brief      The synthetic object of the schema. Every node has FanOut
+ *             children getters, the leaves (Depth 0) have the leaf getter
+ *
+ * @tparam     Depth       Depth of the node
+ * @tparam     FanOut      Number of the children getters
+ * @tparam     LeafSize    Size of the leaf value, bytes
+ */
+template<size_t Depth, size_t FanOut, size_t LeafSize>
+struct Node {
+    using child_t = Node<Depth - 1, FanOut, LeafSize>;
+
+    uint32_t value;
+
+    template<size_t I>
+    void child(child_t & aChild) {
+        aChild.value = value + static_cast<uint32_t>(I) + 1;
+    }
+};
+
+template<size_t FanOut, size_t LeafSize>
+struct Node<0, FanOut, LeafSize> {
+    using leaf_t = std::array<uint8_t, LeafSize>;
+
+    uint32_t value;
+
+    void leaf(leaf_t & aLeaf) {
+        std::memset(aLeaf.data(), static_cast<int>(value), LeafSize);
+    }
+};
+
+/** @{ */
+/* chain_of meta-function, the getters chain of the tag */
+/**
+ * @brief      Initial definition, unused
+ *
+ * @tparam     TNode    Type of the node
+ * @tparam     Path     Index of the tag, the digits in the base FanOut
+ *                      select the children
+ */
+template<typename TNode, size_t Path>
+struct chain_of;
+
+/**
+ * @brief      The leaf node finishes the chain
+ */
+template<size_t FanOut, size_t LeafSize, size_t Path>
+struct chain_of<Node<0, FanOut, LeafSize>, Path> {
+    using type = mil::values_list<&Node<0, FanOut, LeafSize>::leaf>;
+};
+
+/**
+ * @brief      The intermediate node selects the child by the lowest digit
+ */
+template<size_t Depth, size_t FanOut, size_t LeafSize, size_t Path>
+struct chain_of<Node<Depth, FanOut, LeafSize>, Path> {
+    template<typename TRest>
+    struct prepend;
+
+    template<auto ... rest>
+    struct prepend<mil::values_list<rest...>> {
+        using type = mil::values_list<&Node<Depth, FanOut, LeafSize>::template child<Path % FanOut>, rest...>;
+    };
+
+    using type = typename prepend<typename chain_of<Node<Depth - 1, FanOut, LeafSize>, Path / FanOut>::type>::type;
+};
+/** @} */
+
+/**
+ * @brief      Returns the name of the tag
+ *
+ * @param      aIdx    Index of the tag
+ */
+static char const * tagName(size_t aIdx) {
+    static std::vector<std::string> const names { [] {
+        std::vector<std::string> result;
+        for (size_t i { 0 }; i < 1024; ++i) {
+            result.push_back("tag" + std::to_string(i));
+        }
+        return result;
+    }() };
+    return names[aIdx].c_str();
+}
+
+/**
+ * @brief      Consumes the whole leaf, so the inlined engines can't throw
+ *             away the bytes of the leaf the sink doesn't read
+ */
+struct Sink {
+    uint64_t sum;
+
+    template<typename T>
+    void operator()(char const * tag, std::tuple<T> const & aTuple) {
+        auto const & leaf { std::get<0>(aTuple) };
+        doNotOptimize(leaf);
+        sum += static_cast<uint64_t>(leaf.front()) + leaf.back() + static_cast<unsigned char>(tag[3]);
+    }
+};
+
+/**
+ * @brief      Creates the delayed invoke of the chain
+ */
+template<auto ... fx>
+constexpr auto forwarder(mil::values_list<fx...>, char const * aTag) {
+    return mil::delayedInvoke<fx...>(aTag);
+}
+
+/**
+ * @brief      Invokes the chain via chainInvoke and passes the result into
+ *             the sink
+ */
+template<auto ... fx, typename TObj>
+inline void rawChain(mil::values_list<fx...>, TObj & aObj, char const * aTag, Sink & aSink) {
+    aSink(aTag, mil::chainInvoke<fx...>(aObj));
+}
+
+/**
+ * @brief      Hand-written walk through the tag path, without the library
+ */
+template<size_t Path, size_t Depth, size_t FanOut, size_t LeafSize>
+inline void handWalk(Node<Depth, FanOut, LeafSize> & aNode, char const * aTag, Sink & aSink) {
+    if constexpr (0 == Depth) {
+        std::tuple<std::array<uint8_t, LeafSize>> leaf { };
+        aNode.leaf(std::get<0>(leaf));
+        aSink(aTag, leaf);
+    } else {
+        Node<Depth - 1, FanOut, LeafSize> child { };
+        aNode.template child<Path % FanOut>(child);
+        handWalk<Path / FanOut>(child, aTag, aSink);
+    }
+}
+
+/**
+ * @brief      The synthetic schema: Tags chains of Depth + 1 getters through
+ *             the nodes with FanOut children, ending with the LeafSize value
+ *
+ * @tparam     Depth       Number of the intermediate getters
+ * @tparam     FanOut      Number of the children of every node
+ * @tparam     Tags        Number of the tags
+ * @tparam     LeafSize    Size of the leaf value, bytes
+ */
+template<size_t Depth, size_t FanOut, size_t Tags, size_t LeafSize>
+struct schema {
+    using root_t = Node<Depth, FanOut, LeafSize>;
+
+    static constexpr size_t DEPTH     { Depth    };
+    static constexpr size_t FAN_OUT   { FanOut   };
+    static constexpr size_t TAGS      { Tags     };
+    static constexpr size_t LEAF_SIZE { LeafSize };
+
+    template<size_t I>
+    using chain_t = typename chain_of<root_t, I>::type;
+
+    static std::string name() {
+        return "d" + std::to_string(Depth) + "_f" + std::to_string(FanOut) +
+               "_t" + std::to_string(Tags) + "_l" + std::to_string(LeafSize);
+    }
+
+    template<size_t ... I>
+    static auto makeObjectInvoke(std::index_sequence<I...>) {
+        return mil::object_invoke{ mil::useAcceptor<Sink>(), forwarder(chain_t<I>{}, tagName(I))... };
+    }
+
+    template<size_t ... I>
+    static auto makeInlineInvoke(std::index_sequence<I...>) {
+        return mil::inline_object_invoke{ mil::useAcceptor<Sink>(), forwarder(chain_t<I>{}, tagName(I))... };
+    }
+
+    template<size_t ... I>
+    static std::array<char const *, Tags> tags(std::index_sequence<I...>) {
+        return { tagName(I)... };
+    }
+
+    template<size_t ... I>
+    static void chainInvoke(std::index_sequence<I...>, root_t & aObj, std::array<char const *, Tags> const & aTags, Sink & aSink) {
+        (rawChain(chain_t<I>{}, aObj, aTags[I], aSink), ...);
+    }
+
+    template<size_t ... I>
+    static void handWritten(std::index_sequence<I...>, root_t & aObj, std::array<char const *, Tags> const & aTags, Sink & aSink) {
+        (handWalk<I>(aObj, aTags[I], aSink), ...);
+    }
+};
+
+/**
+ * @brief      The result of the single case
+ */
+struct result {
+    std::string   engine;
+    std::string   schema;
+    size_t        depth;
+    size_t        fanOut;
+    size_t        tags;
+    size_t        leafSize;
+    double        nsPerTag;
+    double        instructionsPerTag;
+    double        allocationsPerSnapshot;
+};
+
+/**
+ * @brief      Options of the harness
+ */
+struct options {
+    bool          json      { false };
+    double        minTimeMs { 50.0  };
+    std::string   baseline  { };
+    double        tolerance { 0.10  };
+};
+
+/**
+ * @brief      Measures the snapshot function: the number of iterations is
+ *             calibrated to the minimal time, the best of three repetitions
+ *             is reported
+ *
+ * @tparam     TSchema    The schema
+ *
+ * @param      aEngine    Name of the engine
+ * @param      aOptions   The options
+ * @param      aFn        The snapshot function
+ */
+template<typename TSchema, typename TFn>
+result run(char const * aEngine, options const & aOptions, TFn && aFn) {
+    using clock_t = std::chrono::steady_clock;
+
+    auto const timed = [&](size_t aIterations) {
+        auto const begin { clock_t::now() };
+        for (size_t i { 0 }; i < aIterations; ++i) {
+            aFn();
+        }
+        return std::chrono::duration<double, std::nano>(clock_t::now() - begin).count();
+    };
+
+    size_t iterations { 1 };
+    while (timed(iterations) < aOptions.minTimeMs * 1e6 / 4) {
+        iterations *= 2;
+    }
+
+    double best { timed(iterations) };
+    for (size_t repetition { 1 }; repetition < 3; ++repetition) {
+        best = std::min(best, timed(iterations));
+    }
+
+    instructions_counter counter { };
+    uint64_t const allocationsBefore { allocations.load(std::memory_order_relaxed) };
+    counter.start();
+    for (size_t i { 0 }; i < iterations; ++i) {
+        aFn();
+    }
+    uint64_t const instructions { counter.stop() };
+    uint64_t const allocated { allocations.load(std::memory_order_relaxed) - allocationsBefore };
+
+    double const snapshots { static_cast<double>(iterations) };
+    double const tags      { snapshots * static_cast<double>(TSchema::TAGS) };
+    return result{
+        aEngine, TSchema::name(), TSchema::DEPTH, TSchema::FAN_OUT, TSchema::TAGS, TSchema::LEAF_SIZE,
+        best / tags,
+        counter.valid() ? static_cast<double>(instructions) / tags : -1.0,
+        static_cast<double>(allocated) / snapshots
+    };
+}
+
+/**
+ * @brief      Runs all the engines over the schema
+ *
+ * @tparam     TSchema    The schema
+ */
+template<typename TSchema>
+void runSchema(options const & aOptions, std::vector<result> & aResults) {
+    using indexes_t = std::make_index_sequence<TSchema::TAGS>;
+
+    typename TSchema::root_t obj { 0 };
+    Sink sink { 0 };
+    auto const tags { TSchema::tags(indexes_t{}) };
+
+    auto const objectInvoke { TSchema::makeObjectInvoke(indexes_t{}) };
+    aResults.push_back(run<TSchema>("object_invoke", aOptions, [&] {
+        ++obj.value;
+        objectInvoke(obj, sink);
+        doNotOptimize(sink);
+    }));
+
+    auto const inlineInvoke { TSchema::makeInlineInvoke(indexes_t{}) };
+    aResults.push_back(run<TSchema>("inline_object_invoke", aOptions, [&] {
+        ++obj.value;
+        inlineInvoke(obj, sink);
+        doNotOptimize(sink);
+    }));
+
+    aResults.push_back(run<TSchema>("chainInvoke", aOptions, [&] {
+        ++obj.value;
+        TSchema::chainInvoke(indexes_t{}, obj, tags, sink);
+        doNotOptimize(sink);
+    }));
+
+    aResults.push_back(run<TSchema>("hand-written", aOptions, [&] {
+        ++obj.value;
+        TSchema::handWritten(indexes_t{}, obj, tags, sink);
+        doNotOptimize(sink);
+    }));
+}
+
+/**
+ * @brief      Prints the results as CSV
+ */
+static void printCsv(std::vector<result> const & aResults) {
+    std::cout << "engine,schema,depth,fan_out,tags,leaf_size,ns_per_tag,instructions_per_tag,allocations_per_snapshot\n";
+    for (auto const & r: aResults) {
+        std::cout << r.engine << ',' << r.schema << ',' << r.depth << ',' << r.fanOut << ',' << r.tags << ','
+                  << r.leafSize << ',' << r.nsPerTag << ',' << r.instructionsPerTag << ',' << r.allocationsPerSnapshot << '\n';
+    }
+}
+
+/**
+ * @brief      Prints the results as JSON
+ */
+static void printJson(std::vector<result> const & aResults) {
+    std::cout << "[\n";
+    for (size_t i { 0 }; i < aResults.size(); ++i) {
+        auto const & r { aResults[i] };
+        std::cout << "  {\"engine\": \"" << r.engine << "\", \"schema\": \"" << r.schema
+                  << "\", \"depth\": " << r.depth << ", \"fan_out\": " << r.fanOut << ", \"tags\": " << r.tags
+                  << ", \"leaf_size\": " << r.leafSize << ", \"ns_per_tag\": " << r.nsPerTag
+                  << ", \"instructions_per_tag\": " << r.instructionsPerTag
+                  << ", \"allocations_per_snapshot\": " << r.allocationsPerSnapshot << '}'
+                  << (i + 1 < aResults.size() ? ",\n" : "\n");
+    }
+    std::cout << "]\n";
+}
+
+/**
+ * @brief      Compares the results with the baseline CSV, produced by the
+ *             previous run, and reports the cases slower by more than the
+ *             tolerance, or allocating more
+ *
+ * @return     Number of the regressions
+ */
+static size_t compareWithBaseline(std::vector<result> const & aResults, options const & aOptions) {
+    std::ifstream file { aOptions.baseline };
+    if (!file) {
+        std::cerr << "can't open the baseline: " << aOptions.baseline << '\n';
+        return 1;
+    }
+
+    std::map<std::string, std::pair<double, double>> baseline;
+    std::string line;
+    std::getline(file, line);
+    while (std::getline(file, line)) {
+        std::vector<std::string> fields;
+        std::istringstream stream { line };
+        for (std::string field; std::getline(stream, field, ',');) {
+            fields.push_back(field);
+        }
+        if (fields.size() == 9) {
+            baseline[fields[0] + ',' + fields[1]] = { std::stod(fields[6]), std::stod(fields[8]) };
+        }
+    }
+
+    size_t regressions { 0 };
+    for (auto const & r: aResults) {
+        auto const it { baseline.find(r.engine + ',' + r.schema) };
+        if (it == baseline.end()) {
+            continue;
+        }
+        auto const [nsPerTag, allocationsPerSnapshot] { it->second };
+        if (r.nsPerTag > nsPerTag * (1.0 + aOptions.tolerance) || r.allocationsPerSnapshot > allocationsPerSnapshot) {
+            std::cerr << "REGRESSION " << r.engine << ' ' << r.schema << ": "
+                      << nsPerTag << " -> " << r.nsPerTag << " ns/tag, "
+                      << allocationsPerSnapshot << " -> " << r.allocationsPerSnapshot << " allocations/snapshot\n";
+            ++regressions;
+        }
+    }
+    return regressions;
+}
+
+/**
+ * @brief      Usage: harness [--json] [--min-time ms] [--baseline file.csv]
+ *             [--tolerance fraction]
+ *
+ * @return     Non-zero, if the regressions against the baseline are found
+ */
+int main(int argc, char ** argv) {
+    options opts { };
+    for (int i { 1 }; i < argc; ++i) {
+        std::string const arg { argv[i] };
+        if ("--json" == arg) {
+            opts.json = true;
+        } else if ("--min-time" == arg && i + 1 < argc) {
+            opts.minTimeMs = std::atof(argv[++i]);
+        } else if ("--baseline" == arg && i + 1 < argc) {
+            opts.baseline = argv[++i];
+        } else if ("--tolerance" == arg && i + 1 < argc) {
+            opts.tolerance = std::atof(argv[++i]);
+        } else {
+            std::cerr << "usage: " << argv[0] << " [--json] [--min-time ms] [--baseline file.csv] [--tolerance fraction]\n";
+            return 1;
+        }
+    }
+
+    std::vector<result> results;
+    runSchema<schema<1, 1,  4,    4>>(opts, results);
+    runSchema<schema<3, 2,  8,    4>>(opts, results);
+    runSchema<schema<3, 4, 64,    4>>(opts, results);
+    runSchema<schema<6, 2, 64,    4>>(opts, results);
+    runSchema<schema<3, 2,  8,   64>>(opts, results);
+    runSchema<schema<3, 2,  8, 1024>>(opts, results);
+
+    if (opts.json) {
+        printJson(results);
+    } else {
+        printCsv(results);
+    }
+
+    if (!opts.baseline.empty() && 0 != compareWithBaseline(results, opts)) {
+        return 2;
+    }
+    return 0;
+}
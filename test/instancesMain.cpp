@@ -0,0 +1,127 @@
+/**
+ * @file      instancesMain.cpp
+ *
+ * @brief     Checks the number of the constructions, copies and moves of the
+ *            intermediate and the leaf objects per invoke flavor, fails on
+ *            mismatch
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <object_invoke.h>
+#include <inline_object_invoke.h>
+#include <trie_object_invoke.h>
+#include <workspace_object_invoke.h>
+
+#include "testObjects.h"
+
+constexpr mil::object_invoke invoke {
+    mil::useAcceptor<Serializer>(),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call1"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call2"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call3"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call4")
+};
+
+using namespace mil::literals;
+
+constexpr mil::inline_object_invoke inlineInvoke {
+    mil::useAcceptor<Serializer>(),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call1"_tag),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call2"_tag)
+};
+
+constexpr mil::object_invoke leafInvoke {
+    mil::useAcceptor<Serializer>(),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1>("leaf1"),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1>("leaf2"_tag)
+};
+
+constexpr mil::object_invoke refInvoke {
+    mil::useAcceptor<Serializer>(),
+    mil::delayedInvoke<&Root::node, &Node::leaf, &Leaf::value>("ref1"),
+    mil::delayedInvoke<&Root::node, &Node::leaf>("ref2"_tag)
+};
+
+constexpr mil::inline_object_invoke valueInvoke {
+    mil::useAcceptor<Serializer>(),
+    mil::delayedInvoke<&Root::node, &Node::leafCopy>("value1"_tag)
+};
+
+constexpr mil::trie_object_invoke trieInvoke {
+    mil::useAcceptor<Serializer>(),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call1"_tag),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call2"_tag),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call3"_tag),
+    mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call4"_tag)
+};
+
+int main() {
+    Object3 obj {};
+    Serializer si;
+    bool ok { expectInstances<Object3>("root", 1, 0, 0) };
+
+    invoke(obj, si);
+    ok &= expectInstances<Object2>("object_invoke", 4, 0, 0);
+    ok &= expectInstances<Object1>("object_invoke", 4, 0, 0);
+
+    std::cout << "Leaf results:\n";
+    leafInvoke(obj, si);
+    ok &= expectInstances<Object2>("object_invoke, leaf", 2, 0, 0);
+    ok &= expectInstances<Object1>("object_invoke, leaf", 2, 0, 0);
+
+    inlineInvoke(obj, si);
+    ok &= expectInstances<Object2>("inline_object_invoke", 2, 0, 0);
+    ok &= expectInstances<Object1>("inline_object_invoke", 2, 0, 0);
+
+    std::cout << "Reference results:\n";
+    Root root {};
+    ok &= expectInstances<Root>("root, references", 1, 0, 0);
+    ok &= expectInstances<Node>("root, references", 1, 0, 0);
+    ok &= expectInstances<Leaf>("root, references", 1, 0, 0);
+
+    refInvoke(root, si);
+    ok &= expectInstances<Node>("object_invoke, references", 0, 0, 0);
+    ok &= expectInstances<Leaf>("object_invoke, references", 0, 0, 0);
+
+    std::cout << "Value results:\n";
+    valueInvoke(root, si);
+    ok &= expectInstances<Leaf>("inline_object_invoke, value", 1, 0, 0);
+
+    mil::workspace_object_invoke valueWorkspace { mil::usePolicy<mil::reset_intermediates>(), valueInvoke };
+    valueWorkspace(root, si);
+    ok &= expectInstances<Leaf>("workspace_object_invoke, value", 1, 0, 0);
+
+    std::cout << "Shared prefix invoke:\n";
+    trieInvoke(obj, si);
+    ok &= expectInstances<Object2>("trie_object_invoke", 1, 0, 0);
+    ok &= expectInstances<Object1>("trie_object_invoke", 1, 0, 0);
+
+    std::cout << "Workspace invoke:\n";
+    mil::workspace_object_invoke workspaceInvoke { mil::usePolicy<mil::reset_intermediates>(), inlineInvoke };
+    ok &= expectInstances<Object2>("workspace_object_invoke, allocation", 2, 0, 0);
+    ok &= expectInstances<Object1>("workspace_object_invoke, allocation", 2, 0, 0);
+
+    workspaceInvoke(obj, si);
+    workspaceInvoke(obj, si);
+    ok &= expectInstances<Object2>("workspace_object_invoke", 0, 0, 0);
+    ok &= expectInstances<Object1>("workspace_object_invoke", 0, 0, 0);
+
+    return ok ? 0 : 1;
+}
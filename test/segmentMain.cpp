@@ -0,0 +1,106 @@
+/**
+ * @file      segmentMain.cpp
+ *
+ * @brief     Checks the segment files: the records, which fill the segment
+ *            exactly up to the room of the rollover mark, and the rollover
+ *            into the next segments
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include <inline_object_invoke.h>
+#include <segment_acceptor.h>
+
+struct Counter {
+    void getValue(uint32_t & v) {
+        v = value++;
+    }
+
+    uint32_t value { 0 };
+};
+
+constexpr mil::inline_object_invoke counterInvoke {
+    mil::useAcceptor<mil::segment_acceptor>(),
+    mil::delayedInvoke<&Counter::getValue>("value")
+};
+
+/**
+ * @brief      Writes the records into the segments and reads them back
+ *
+ * @param      aSegmentSize    Capacity of the segments
+ * @param      aPreallocate    The preallocation step
+ * @param      aRecords        Number of the records
+ * @param      aSegments       Expected number of the segments
+ *
+ * @return     true, if all the records are read back in order
+ */
+static bool expectRollover(size_t aSegmentSize, size_t aPreallocate, uint32_t aRecords, uint64_t aSegments) {
+    char const * const tmp { std::getenv("TMPDIR") };
+    std::string const prefix { std::string{ nullptr != tmp ? tmp : "/tmp" } + "/mil_segment_"
+                               + std::to_string(::getpid()) + "_" + std::to_string(aSegmentSize) };
+
+    Counter counter { };
+    mil::segment_acceptor segment { };
+    bool ok { segment.open(prefix, 0, aSegmentSize, aPreallocate) };
+    for (uint32_t i { 0 }; ok && i < aRecords; ++i) {
+        counterInvoke(counter, segment);
+    }
+    ok = ok && !segment.failed() && aSegments == segment.segment() + 1;
+    uint64_t const segments { segment.segment() + 1 };
+    segment.close();
+
+    mil::segment_reader reader { };
+    mil::segment_record record { };
+    uint32_t read { 0 };
+    reader.open(prefix);
+    for (; reader.next(record); ++read) {
+        ok = ok && sizeof(uint64_t) + sizeof(uint32_t) == record.size
+                && read == mil::detail::readLittleEndian<uint32_t>(record.data + sizeof(uint64_t));
+    }
+    ok = ok && !reader.failed() && aRecords == read && segments == reader.segment();
+    reader.close();
+
+    for (uint64_t i { 0 }; i < segments; ++i) {
+        std::remove(mil::detail::segmentPath(prefix, i).c_str());
+    }
+
+    if (!ok) {
+        std::cout << "FAILED: segment size '" << aSegmentSize << "', records '" << aRecords
+                  << "': segments '" << segments << "', read back '" << read << "'" << std::endl;
+    }
+    return ok;
+}
+
+int main() {
+    /* 16 bytes frames: 510 of them fill the 8192 bytes segment up to the end,
+     * so only 509 fit with the room for the rollover mark */
+    bool ok { expectRollover(8192, 4096, 509, 1) };
+    ok &= expectRollover(8192, 4096, 510, 2);
+    ok &= expectRollover(8192, 4096, 600, 2);
+    ok &= expectRollover(8192, 8192, 509 * 3 + 1, 4);
+    ok &= expectRollover(12288, 4096, 2000, 3);
+
+    return ok ? 0 : 1;
+}
@@ -21,77 +21,51 @@
  */
 
 #include <cstdint>
+#include <cstddef>
 #include <iostream>
+#include <iomanip>
+#include <limits>
+#include <initializer_list>
 
 #include <object_invoke.h>
+#include <protobuf_acceptor.h>
 
-template<typename T>
-struct InstanceCounter {
-    static size_t instances;
+#include "testObjects.h"
 
-    InstanceCounter() { this->incAndLog(); }
-    InstanceCounter(InstanceCounter const &) { this->incAndLog(); }
-    InstanceCounter(InstanceCounter &&) noexcept { this->incAndLog(); }
-    ~InstanceCounter() { this->decAndLog(); }
-
-    InstanceCounter & operator=(InstanceCounter const &) = default;
-    InstanceCounter & operator=(InstanceCounter &&) = default;
-
-    void incAndLog() const {
-        ++instances;
-        std::cout << "    +++New object \'" << typeid(T).name() << "\', addr: \'"
-                  << static_cast<void const *>(this) << "\' created, total: \'"
-                  << instances << "\'" << std::endl;
-    }
-
-    void decAndLog() const {
-        --instances;
-        std::cout << "    ---Object \'" << typeid(T).name() << "\', addr: \'"
-                  << static_cast<void const *>(this) << "\' destroyed, total: \'"
-                  << instances << "\'" << std::endl;
-    }
-};
-
-template<typename T>
-size_t InstanceCounter<T>::instances { 0ull };
-
-struct Object1
-    : public InstanceCounter<Object1> {
-    void getValue(int & i) {
-    //    std::cout << " getValue invoked!" << std::endl;
-        static int ii { 11111 };
-        ii += 11111;
-        i = ii;
+/**
+ * @brief      Checks the bytes written by the acceptor
+ *
+ * @return     true, if the bytes are expected
+ */
+bool expectBytes(char const * aWhat, unsigned char const * aData, size_t aSize,
+                 std::initializer_list<unsigned> aExpected) {
+    bool ok { aSize == aExpected.size() };
+    for (size_t i { 0 }; ok && i < aSize; ++i) {
+        ok = aExpected.begin()[i] == aData[i];
     }
-};
-
-struct Object2
-    : public InstanceCounter<Object2> {
-    void getObject1(Object1 & obj) {
-      //  std::cout << "  getObject1 invoked!" << std::endl;
-        (void)obj;
+    if (!ok) {
+        std::cout << "FAILED: " << aWhat << ":" << std::hex;
+        for (size_t i { 0 }; i < aSize; ++i) {
+            std::cout << ' ' << std::setw(2) << std::setfill('0') << unsigned { aData[i] };
+        }
+        std::cout << std::dec << std::setfill(' ') << std::endl;
     }
-};
+    return ok;
+}
 
-struct Object3
-    : public InstanceCounter<Object3> {
-    void getObject2(Object2 * obj) {
-        //std::cout << "  getObject2 invoked!" << std::endl;
-    }
+enum class Sign : int {
+    NEGATIVE = -2
 };
 
-struct Serializer {
-    template<typename ... T>
-    void operator()(char const * tag, std::tuple<T...> const & aTuple) {
-        std::cout << "\'" << tag << "\': \'";
-        putStream(std::cout, aTuple, std::make_index_sequence<sizeof...(T)>{});
-        std::cout << "\'\n";
-    }
-
-    template<typename Tuple, size_t ... Idx>
-    static std::ostream & putStream(std::ostream & aOs, Tuple const & t, std::index_sequence<Idx...>) {
-        return (aOs << ... << std::get<Idx>(t));
-    }
+struct Wire {
+    void getMinusOne(int32_t & i) const { i = -1; }
+    void getMin(int32_t & i) const { i = std::numeric_limits<int32_t>::min(); }
+    void getMax(uint64_t & u) const { u = std::numeric_limits<uint64_t>::max(); }
+    void getSign(Sign & s) const { s = Sign::NEGATIVE; }
+    void getFloat(float & f) const { f = 1.5f; }
+    void getDouble(double & d) const { d = -2.25; }
+    void getPair(int32_t & i, uint8_t & u) const { i = -3; u = 200; }
+    void getFixed(float & f, bool & b) const { f = 0.5f; b = true; }
 };
 
 
@@ -104,12 +78,43 @@ constexpr mil::object_invoke invoke {
     mil::delayedInvoke<&Object3::getObject2, &Object2::getObject1, &Object1::getValue>("call4")
 };
 
+constexpr mil::object_invoke wireInvoke {
+    mil::useAcceptor<mil::protobuf_acceptor>(),
+    mil::delayedInvoke<&Wire::getMinusOne>("minusOne"),
+    mil::delayedInvoke<&Wire::getMin>("min"),
+    mil::delayedInvoke<&Wire::getMax>("max"),
+    mil::delayedInvoke<&Wire::getSign>("sign"),
+    mil::delayedInvoke<&Wire::getFloat>("float"),
+    mil::delayedInvoke<&Wire::getDouble>("double"),
+    mil::delayedInvoke<&Wire::getPair>("pair"),
+    mil::delayedInvoke<&Wire::getFixed>("fixed")
+};
+
+constexpr auto wireSchema { wireInvoke.schema() };
 
 int main() {
     Object3 obj {};
     Serializer si;
+    bool ok { true };
 
     invoke(obj, si);
-    
-    return 0;
+
+    std::cout << "Protobuf wire format:\n";
+    Wire wire {};
+    unsigned char buffer[128];
+    mil::protobuf_acceptor wireAcceptor { buffer, sizeof(buffer), wireSchema };
+    wireInvoke(wire, wireAcceptor);
+    ok &= !wireAcceptor.overflow();
+    ok &= expectBytes("protobuf_acceptor", wireAcceptor.data(), wireAcceptor.size(), {
+        0x08, 0x01,                                                        /* sint32 -1 */
+        0x10, 0xff, 0xff, 0xff, 0xff, 0x0f,                                /* sint32 INT32_MIN */
+        0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,  /* uint64 max */
+        0x20, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,  /* enum -2 */
+        0x2d, 0x00, 0x00, 0xc0, 0x3f,                                      /* float 1.5 */
+        0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc0,              /* double -2.25 */
+        0x3a, 0x05, 0x08, 0x05, 0x10, 0xc8, 0x01,                          /* {-3, 200}, patched length */
+        0x42, 0x07, 0x0d, 0x00, 0x00, 0x00, 0x3f, 0x10, 0x01               /* {0.5, true}, exact length */
+    });
+
+    return ok ? 0 : 1;
 }
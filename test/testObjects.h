@@ -0,0 +1,170 @@
+/**
+ * @file      testObjects.h
+ *
+ * @brief     Contains the test objects shared by the demo and the tests: the
+ *            objects counting their instances and the printing acceptor
+ *
+ * @author    Alexander Ganyukhin (alexander.ganyukhin@mera.com)
+ *
+ * @date      2026-October-16
+ *
+ * Copyright 2026 Mera
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ * use this file except in compliance with the License. You may obtain a copy of
+ * the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations under
+ * the License.
+ */
+#ifndef TEST__TEST_OBJECTS__H
+#define TEST__TEST_OBJECTS__H
+
+#include <cstddef>
+#include <iostream>
+#include <tuple>
+#include <typeinfo>
+#include <utility>
+
+template<typename T>
+struct InstanceCounter {
+    static size_t instances;
+    static size_t constructed;
+    static size_t copied;
+    static size_t moved;
+
+    InstanceCounter() { ++constructed; this->incAndLog(); }
+    InstanceCounter(InstanceCounter const &) { ++copied; this->incAndLog(); }
+    InstanceCounter(InstanceCounter &&) noexcept { ++moved; this->incAndLog(); }
+    ~InstanceCounter() { this->decAndLog(); }
+
+    InstanceCounter & operator=(InstanceCounter const &) = default;
+    InstanceCounter & operator=(InstanceCounter &&) = default;
+
+    void incAndLog() const {
+        ++instances;
+        std::cout << "    +++New object \'" << typeid(T).name() << "\', addr: \'"
+                  << static_cast<void const *>(this) << "\' created, total: \'"
+                  << instances << "\'" << std::endl;
+    }
+
+    void decAndLog() const {
+        --instances;
+        std::cout << "    ---Object \'" << typeid(T).name() << "\', addr: \'"
+                  << static_cast<void const *>(this) << "\' destroyed, total: \'"
+                  << instances << "\'" << std::endl;
+    }
+};
+
+template<typename T>
+size_t InstanceCounter<T>::instances { 0ull };
+
+template<typename T>
+size_t InstanceCounter<T>::constructed { 0ull };
+
+template<typename T>
+size_t InstanceCounter<T>::copied { 0ull };
+
+template<typename T>
+size_t InstanceCounter<T>::moved { 0ull };
+
+/**
+ * @brief      Checks the number of constructions, copies and moves since the
+ *             last check, and resets the counters
+ *
+ * @return     true, if the counters are expected
+ */
+template<typename T>
+bool expectInstances(char const * aWhat, size_t aConstructed, size_t aCopied, size_t aMoved) {
+    bool const ok { aConstructed == T::constructed && aCopied == T::copied && aMoved == T::moved };
+    if (!ok) {
+        std::cout << "FAILED: " << aWhat << " '" << typeid(T).name() << "': constructed '"
+                  << T::constructed << "', copied '" << T::copied << "', moved '"
+                  << T::moved << "'" << std::endl;
+    }
+    T::constructed = T::copied = T::moved = 0;
+    return ok;
+}
+
+struct Object1
+    : public InstanceCounter<Object1> {
+    void getValue(int & i) {
+    //    std::cout << " getValue invoked!" << std::endl;
+        static int ii { 11111 };
+        ii += 11111;
+        i = ii;
+    }
+};
+
+struct Object2
+    : public InstanceCounter<Object2> {
+    void getObject1(Object1 & obj) {
+      //  std::cout << "  getObject1 invoked!" << std::endl;
+        (void)obj;
+    }
+};
+
+struct Object3
+    : public InstanceCounter<Object3> {
+    void getObject2(Object2 * obj) {
+        //std::cout << "  getObject2 invoked!" << std::endl;
+    }
+};
+
+struct Leaf
+    : public InstanceCounter<Leaf> {
+    int value() const {
+        return 7;
+    }
+};
+
+struct Node
+    : public InstanceCounter<Node> {
+    Leaf const & leaf() const {
+        return child;
+    }
+
+    Leaf leafCopy() const {
+        return Leaf{};
+    }
+
+    Leaf child;
+};
+
+struct Root
+    : public InstanceCounter<Root> {
+    Node const & node() const {
+        return child;
+    }
+
+    Node child;
+};
+
+inline std::ostream & operator<<(std::ostream & aOs, Object1 const &) {
+    return aOs << "Object1";
+}
+
+inline std::ostream & operator<<(std::ostream & aOs, Leaf const &) {
+    return aOs << "Leaf";
+}
+
+struct Serializer {
+    template<typename ... T>
+    void operator()(char const * tag, std::tuple<T...> const & aTuple) {
+        std::cout << "\'" << tag << "\': \'";
+        putStream(std::cout, aTuple, std::make_index_sequence<sizeof...(T)>{});
+        std::cout << "\'\n";
+    }
+
+    template<typename Tuple, size_t ... Idx>
+    static std::ostream & putStream(std::ostream & aOs, Tuple const & t, std::index_sequence<Idx...>) {
+        return (aOs << ... << std::get<Idx>(t));
+    }
+};
+
+#endif /* end of #ifndef TEST__TEST_OBJECTS__H */
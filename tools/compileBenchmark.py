@@ -0,0 +1,153 @@
+#!/usr/bin/python3
+"""
+Compile-time benchmark: generates the synthetic schemas with the given number
+of tags, compiles every one of them and reports the compile time and the peak
+memory of the compiler as CSV.
+
+The schema is the root object with the groups of the fields, every tag is the
+chain `&Root::groupN, &GroupN::fieldM`, the fields alternate between the
+out-params getters and the returning ones. The tags are the runtime
+`char const *` tags or the compile-time `_tag` ones, the latter are checked for
+the id collisions in compile time.
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+import time
+
+FIELDS_PER_GROUP = 10
+
+header = """#include <tuple>
+#include <cstdint>
+
+#include <object_invoke.h>
+#include <inline_object_invoke.h>
+
+struct Sink {{
+    uint64_t sum {{ 0 }};
+
+    template<typename T>
+    void operator()(char const * tag, std::tuple<T> const & aTuple) {{
+        sum += static_cast<uint64_t>(std::get<0>(aTuple)) + static_cast<unsigned char>(tag[0]);
+    }}
+
+    template<char ... cs, typename T>
+    void operator()(mil::tag_string<cs...>, std::tuple<T> const & aTuple) {{
+        sum += static_cast<uint64_t>(std::get<0>(aTuple)) + mil::tag_string<cs...>::id;
+    }}
+}};
+
+using namespace mil::literals;
+"""
+
+group = """
+struct Group{0} {{
+    int values[{1}];
+{2}}};
+"""
+
+outParamsGetter = """
+    void getField{0}(int & aValue) {{
+        aValue = values[{0}];
+    }}
+"""
+
+returningGetter = """
+    int field{0}() const {{
+        return values[{0}];
+    }}
+"""
+
+root = """
+struct Root {{
+{0}}};
+"""
+
+rootMember = """    Group{0} group{0}Member;
+
+    Group{0} & group{0}() {{
+        return group{0}Member;
+    }}
+"""
+
+invoke = """
+constexpr mil::{0} invoke {{
+    mil::useAcceptor<Sink>(),
+{1}
+}};
+
+int main() {{
+    static Root root {{ }};
+    Sink sink {{ }};
+    invoke(root, sink);
+    return static_cast<int>(sink.sum & 0x7f);
+}}
+"""
+
+
+def fieldGetter(field):
+    if field % 2:
+        return "&Group{{0}}::field{0}".format(field)
+    return "&Group{{0}}::getField{0}".format(field)
+
+
+def generate(tags, flavor, kind):
+    groups = (tags + FIELDS_PER_GROUP - 1) // FIELDS_PER_GROUP
+    source = header.format()
+
+    for g in range(groups):
+        getters = ''
+        for f in range(FIELDS_PER_GROUP):
+            getters += (returningGetter if f % 2 else outParamsGetter).format(f)
+        source += group.format(g, FIELDS_PER_GROUP, getters)
+
+    source += root.format(''.join(rootMember.format(g) for g in range(groups)))
+
+    invokers = []
+    for tag in range(tags):
+        g, f = divmod(tag, FIELDS_PER_GROUP)
+        invokers.append('    mil::delayedInvoke<&Root::group{0}, {1}>("g{0}.f{2}"{3})'.format(
+            g, fieldGetter(f).format(g), f, '_tag' if 'literal' == kind else ''))
+    source += invoke.format(flavor, ',\n'.join(invokers))
+    return source
+
+
+def compile(compiler, flags, include, source, output):
+    begin = time.monotonic()
+    process = subprocess.Popen([compiler] + flags + ['-I', include, '-c', source, '-o', output])
+    _, status, usage = os.wait4(process.pid, 0)
+    seconds = time.monotonic() - begin
+    if 0 != status:
+        sys.exit('compilation failed: ' + source)
+    # ru_maxrss is in kilobytes on linux
+    return seconds, usage.ru_maxrss / 1024.0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--tags', default='250,500,1000,2000', help='comma separated numbers of the tags')
+    parser.add_argument('--flavors', default='object_invoke,inline_object_invoke', help='comma separated invoke flavors')
+    parser.add_argument('--kinds', default='string,literal',
+                        help='comma separated kinds of the tags: string (char const *) and literal (_tag)')
+    parser.add_argument('--compiler', default='g++')
+    parser.add_argument('--flags', default='-std=c++17 -O2', help='compiler flags')
+    parser.add_argument('--include', default=os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'include'))
+    parser.add_argument('--out', default='compile_benchmark', help='directory for the generated sources')
+    args = parser.parse_args()
+
+    os.makedirs(args.out, exist_ok=True)
+    print('flavor,kind,tags,seconds,max_rss_mb')
+    for flavor in args.flavors.split(','):
+        for kind in args.kinds.split(','):
+            for tags in (int(t) for t in args.tags.split(',')):
+                source = os.path.join(args.out, '{0}_{1}_{2}.cpp'.format(flavor, kind, tags))
+                with open(source, 'w') as file:
+                    file.write(generate(tags, flavor, kind))
+                seconds, rss = compile(args.compiler, args.flags.split(), args.include, source, source + '.o')
+                print('{0},{1},{2},{3:.2f},{4:.1f}'.format(flavor, kind, tags, seconds, rss), flush=True)
+
+
+if __name__ == "__main__":
+    main()